@@ -62,6 +62,11 @@ sudo make install
 echo "Copying built extension to dist directory..."
 cp modules/phpoker.so ../dist/
 
+# Ship the precomputed heads-up preflop table alongside the extension
+if [ -f "../data/preflop.bin" ]; then
+    cp ../data/preflop.bin ../dist/
+fi
+
 # Return to the project root
 cd ..
 
@@ -73,6 +78,7 @@ echo "A copy is also available at: dist/phpoker.so"
 echo ""
 echo "Then enable it in your php.ini:"
 echo "extension=phpoker.so"
+echo "phpoker.preflop_table=/path/to/dist/preflop.bin"
 echo ""
 echo "You can test the extension by running:"
 echo "php test.php"
@@ -1422,6 +1422,855 @@ unsigned short hash_values[] =
 */
 int primes[] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41 };
 
+/*
+** Additive rank keys for the direct 6- and 7-card evaluator.
+** The sum of the keys of any seven (or any six) cards is unique
+** for every distinct rank multiset, so the sum can be used as a
+** perfect hash of the rank counts.  Since the keys are additive,
+** the sum for a partial hand (e.g. the board) can be computed once
+** and extended card by card.
+*/
+unsigned int rank_keys[] = {
+    0, 1, 5, 22, 98, 453, 2031, 8698, 22854, 83661, 262349, 636345, 1479181
+};
+
+/*
+** Row displacement tables for the summed rank keys of 6- and 7-card
+** hands.  A key is split into a row (low 12 bits) and a column (the
+** remaining bits); every row was shifted so that no two hands of either
+** size share a slot, which packs the 67,600 distinct rank multisets into
+** a 69,445-entry value table:
+**
+**     value = lookup[rank_offsetsN[key & 0xfff] + (key >> 12)]
+*/
+unsigned int rank_offsets6[] =
+{
+    1074, 7813, 39713, 1160, 3963, 2046, 7246, 20, 4152, 13721,
+    4235, 655, 5864, 4668, 13536, 46703, 31270, 11853, 2446, 127,
+    16008, 16437, 2743, 52010, 4474, 4976, 14789, 28773, 2390, 9971,
+    5394, 10147, 899, 6354, 18990, 30343, 60351, 15717, 32728, 18897,
+    42950, 358, 62430, 66324, 20895, 19686, 64776, 16834, 52019, 23335,
+    29155, 9448, 36201, 3665, 38615, 138, 23933, 11201, 16862, 17276,
+    60102, 8393, 506, 17911, 9850, 34, 31312, 57314, 7823, 19733,
+    17818, 59002, 1372, 20967, 8994, 8457, 2260, 19008, 3708, 10725,
+    7124, 51, 6011, 2088, 323, 5363, 3171, 7954, 54540, 4072,
+    62438, 2213, 24569, 4018, 2631, 16950, 19643, 2431, 2178, 495,
+    2142, 3039, 67319, 6314, 3811, 44, 4006, 3243, 21877, 8219,
+    724, 15438, 2218, 11970, 11482, 1210, 12261, 30106, 23997, 41175,
+    947, 19768, 56466, 41810, 64876, 4198, 3733, 49535, 12202, 6723,
+    18526, 10886, 10583, 5755, 664, 31996, 18939, 11032, 36593, 18305,
+    2160, 22531, 8545, 4343, 9918, 18832, 4100, 16139, 19955, 41231,
+    4925, 7367, 11920, 13040, 4430, 20848, 22364, 27246, 22, 46,
+    35044, 48312, 20061, 31324, 24, 3829, 64851, 18417, 46349, 5163,
+    3232, 5728, 64920, 4765, 48032, 12407, 1861, 5841, 29951, 11741,
+    4669, 1325, 13737, 26493, 16322, 42667, 13838, 45006, 117, 37704,
+    7068, 41950, 8125, 15469, 10770, 18197, 13249, 66370, 17578, 8777,
+    20352, 2683, 9623, 45378, 5530, 9735, 54681, 12935, 235, 17109,
+    6088, 32962, 7449, 5845, 6602, 50134, 59057, 11123, 15594, 35546,
+    49386, 27383, 11653, 18658, 53898, 7706, 31514, 18878, 15193, 36603,
+    13505, 561, 40857, 16176, 3127, 5530, 7996, 62466, 13896, 33800,
+    67360, 10115, 64993, 8512, 2885, 2545, 49821, 13057, 4268, 4665,
+    59059, 32777, 55231, 8702, 6647, 3231, 62385, 9052, 8639, 25652,
+    20449, 4798, 28859, 13829, 15089, 25154, 12600, 11925, 66233, 40478,
+    4677, 64975, 27965, 3025, 2764, 10435, 5009, 20041, 10503, 6012,
+    18097, 26343, 10675, 10577, 4646, 11883, 11401, 3377, 14176, 11510,
+    33175, 10149, 21232, 25681, 59098, 39342, 25840, 9771, 12473, 39958,
+    10390, 26717, 24434, 2329, 51588, 30872, 28382, 25195, 1834, 31173,
+    2296, 37327, 27504, 1006, 15831, 37038, 21643, 22468, 21333, 3430,
+    11793, 2982, 22398, 67180, 50172, 37476, 55798, 32604, 41314, 14862,
+    800, 9456, 11730, 17183, 3659, 7407, 23839, 24482, 9154, 6052,
+    16082, 2751, 24521, 67161, 66244, 30110, 12061, 62526, 6410, 21693,
+    10076, 11955, 1832, 32015, 13053, 18074, 6905, 23892, 9254, 27285,
+    3343, 4784, 12346, 52241, 1416, 9964, 20783, 20030, 26929, 21492,
+    6958, 2138, 2362, 13586, 14980, 13608, 1899, 14160, 58516, 11854,
+    23835, 1065, 5480, 44216, 14315, 12758, 8282, 6179, 4374, 20677,
+    3984, 66090, 24864, 57611, 15451, 7445, 15787, 49266, 9435, 21452,
+    7027, 30346, 53857, 34500, 2680, 16824, 27374, 3217, 10306, 1569,
+    34730, 11251, 30616, 6524, 9745, 15, 64487, 17863, 16346, 25304,
+    59160, 26969, 12111, 1771, 11431, 546, 19447, 1407, 20352, 61634,
+    37142, 62484, 4289, 64853, 22347, 22574, 2914, 20506, 8591, 10401,
+    15815, 18064, 37573, 1565, 39621, 34689, 26585, 2003, 1889, 0,
+    64634, 4338, 23107, 15947, 48461, 4302, 57924, 29411, 11782, 22146,
+    5777, 3356, 46805, 4080, 3601, 19010, 16670, 16540, 25986, 49706,
+    37349, 16790, 24064, 14748, 33600, 35392, 21236, 55291, 33744, 62448,
+    6589, 1351, 44097, 39699, 293, 21685, 14744, 50182, 20191, 0,
+    6340, 12656, 40968, 3870, 28940, 29338, 54654, 8002, 38287, 44271,
+    62390, 9082, 6024, 2238, 29337, 28044, 11616, 65006, 23511, 56098,
+    64866, 15073, 5566, 34428, 48597, 48986, 54871, 55758, 688, 31194,
+    552, 62621, 314, 64943, 7177, 14147, 13860, 54690, 18199, 4263,
+    10748, 27454, 54562, 15628, 17460, 45319, 59181, 1684, 35088, 31317,
+    62544, 11182, 25387, 7654, 3, 38173, 8972, 5890, 30928, 62601,
+    28672, 51080, 66412, 65086, 6690, 62656, 19658, 62649, 54305, 52515,
+    6048, 44517, 7795, 47263, 2018, 24742, 59, 45724, 14306, 3528,
+    62040, 54083, 13112, 5957, 46804, 55386, 44976, 23230, 39743, 28046,
+    1455, 12285, 7751, 23291, 3194, 15870, 524, 17309, 1993, 32201,
+    8132, 21429, 33637, 24633, 26043, 17237, 1663, 59207, 10745, 44354,
+    527, 17882, 28816, 66249, 36128, 43882, 3064, 27950, 64883, 29764,
+    2649, 12964, 22830, 24524, 18152, 7637, 36886, 56277, 5278, 11507,
+    46655, 17393, 49598, 5076, 32661, 18252, 31486, 38962, 10657, 35234,
+    20309, 12292, 16861, 16178, 17068, 26600, 18552, 721, 255, 7801,
+    6016, 17696, 10702, 6011, 6284, 10661, 33291, 10031, 22698, 29495,
+    36047, 38726, 35205, 11359, 54603, 66402, 62616, 4976, 63100, 65119,
+    14378, 4826, 14028, 1058, 64736, 9077, 8369, 52890, 59127, 64879,
+    17980, 24105, 32730, 54736, 15078, 38525, 29648, 62575, 59136, 24920,
+    41157, 37235, 56696, 62089, 17596, 28208, 24989, 13015, 19098, 3687,
+    18968, 17745, 32678, 33962, 57258, 17941, 30280, 7400, 59961, 19540,
+    7824, 11278, 22893, 63600, 59149, 5597, 6545, 19221, 27174, 60670,
+    38137, 20446, 13452, 38635, 8790, 7201, 13188, 36416, 56811, 30655,
+    3488, 29573, 17570, 50744, 16990, 44925, 59019, 50610, 2779, 13295,
+    1718, 2376, 1911, 2304, 5415, 62802, 41994, 17893, 35814, 18466,
+    54521, 38961, 7775, 14506, 30487, 42083, 19895, 35798, 65712, 5881,
+    29, 899, 44354, 58854, 9875, 9567, 18250, 41303, 24788, 50502,
+    26388, 49058, 66224, 51717, 21513, 53929, 18402, 10375, 8956, 26584,
+    37443, 66179, 14772, 19528, 49340, 5483, 47498, 15139, 32461, 9758,
+    56294, 16862, 19063, 9963, 6294, 25622, 34851, 5418, 24238, 19328,
+    28887, 1143, 19409, 7014, 30380, 14798, 4904, 19024, 14714, 62461,
+    53984, 7131, 22686, 15152, 20208, 62433, 16480, 4542, 44610, 6260,
+    37751, 67382, 2518, 13068, 11574, 37429, 33936, 21805, 64948, 55575,
+    62663, 17213, 54693, 10988, 58970, 54408, 25838, 67250, 31342, 42082,
+    31100, 61145, 4737, 67365, 37685, 7644, 8903, 33677, 17040, 62255,
+    16300, 7035, 19925, 48520, 23947, 46386, 20870, 22820, 36657, 39832,
+    28528, 29187, 39546, 62633, 46139, 44986, 50397, 22030, 62683, 20063,
+    10473, 33975, 31914, 19889, 24245, 49335, 42547, 36870, 32859, 18812,
+    62742, 18740, 34022, 15921, 20131, 5926, 40011, 34221, 23563, 66354,
+    12450, 2193, 32214, 13641, 26387, 23946, 20752, 44937, 20710, 25075,
+    20186, 11707, 3781, 13872, 919, 26023, 7686, 20844, 66507, 9529,
+    34099, 26245, 30599, 44384, 26291, 21910, 66388, 47157, 66357, 20950,
+    10106, 20663, 25627, 26187, 4771, 66275, 10495, 65007, 16791, 43840,
+    9954, 27172, 55132, 2183, 8772, 7887, 62617, 62658, 17447, 15255,
+    53912, 62756, 41611, 3586, 14170, 12320, 23047, 26294, 41283, 30626,
+    59515, 21569, 33728, 22422, 24708, 43461, 36565, 63910, 44553, 14589,
+    25421, 10993, 66441, 11928, 25931, 35336, 38522, 62646, 61714, 22612,
+    31962, 23640, 37194, 25862, 24246, 53630, 27038, 4257, 25264, 44395,
+    1029, 66547, 14274, 20534, 29432, 23130, 5213, 19754, 51396, 65027,
+    49378, 5795, 25156, 65098, 47488, 5531, 65302, 22493, 5001, 22267,
+    29099, 13854, 21438, 17105, 32167, 0, 23092, 47599, 56551, 16462,
+    24653, 39869, 40372, 66336, 7502, 54820, 19179, 8073, 9183, 9048,
+    28872, 16755, 15966, 12982, 40577, 32769, 26989, 11624, 26560, 51138,
+    49, 10751, 40495, 16431, 59194, 8182, 54935, 44590, 40370, 36981,
+    15924, 33650, 44003, 64991, 9979, 44542, 62769, 63821, 43190, 10204,
+    57558, 22487, 21888, 15320, 19435, 61305, 21486, 62492, 14064, 10560,
+    41565, 36164, 37227, 15578, 28480, 4622, 62686, 24024, 54759, 32122,
+    62623, 26445, 23113, 29393, 34918, 17708, 3878, 99, 25422, 30141,
+    49275, 35477, 26694, 7576, 19799, 38643, 29601, 59060, 12776, 11676,
+    14449, 13777, 1020, 58039, 22040, 36214, 13977, 23344, 13794, 17244,
+    23613, 50597, 2515, 54964, 14413, 3223, 35284, 16305, 53213, 1008,
+    58881, 1238, 11815, 67383, 48102, 17630, 36141, 31561, 62482, 6753,
+    19344, 14395, 59322, 8626, 49224, 1401, 27579, 17286, 11980, 25381,
+    31181, 41190, 35844, 31936, 564, 41437, 2292, 35242, 35565, 54850,
+    46564, 2764, 14243, 41465, 23166, 20594, 40237, 16203, 7285, 3277,
+    38168, 10544, 46841, 37297, 57563, 14892, 1942, 34769, 12024, 13255,
+    59675, 50093, 31024, 67140, 2059, 26650, 9618, 24861, 10395, 16648,
+    65126, 16360, 18252, 17738, 10523, 32912, 8250, 51713, 21300, 8989,
+    39542, 65146, 27624, 14070, 37785, 14497, 35964, 23727, 46996, 64875,
+    34989, 16382, 19079, 52949, 42650, 20982, 53672, 21930, 49869, 18725,
+    574, 30603, 12842, 10972, 28614, 10804, 39829, 6557, 27040, 16299,
+    14303, 8074, 15509, 29876, 28635, 59293, 21281, 1615, 11246, 65019,
+    65001, 17777, 20123, 26372, 43034, 2628, 8343, 25628, 251, 12662,
+    10017, 36797, 59329, 21034, 66391, 6666, 16397, 55708, 19494, 20498,
+    20790, 13128, 57321, 28025, 32876, 29694, 1143, 39221, 49170, 35654,
+    13879, 47212, 21993, 56222, 23258, 18876, 61115, 28592, 32454, 39036,
+    23638, 37668, 65782, 16569, 31806, 13132, 9462, 4428, 29154, 20764,
+    67682, 52107, 65147, 28159, 34858, 24472, 28630, 23553, 26138, 26422,
+    4091, 23640, 46964, 67105, 13323, 59033, 22972, 37586, 50411, 26188,
+    41348, 56439, 14927, 41967, 29489, 45157, 15072, 55978, 23693, 152,
+    15556, 23065, 7165, 22536, 9841, 21295, 7863, 35292, 24383, 4873,
+    26749, 18352, 25386, 22916, 48250, 3907, 17281, 19705, 3182, 35295,
+    4779, 62480, 23060, 24566, 58380, 20866, 10535, 18618, 40654, 34219,
+    29795, 33693, 22186, 40796, 20923, 38565, 16925, 25115, 55281, 3074,
+    57202, 27113, 17553, 84, 43795, 50559, 27086, 5916, 47255, 4115,
+    3094, 7667, 59649, 23983, 21449, 38017, 40974, 25414, 49018, 43836,
+    34445, 37253, 19081, 11570, 7574, 27451, 34394, 17941, 28490, 33056,
+    38834, 89, 54805, 15046, 27180, 48, 9383, 24561, 17314, 12233,
+    31191, 14190, 19408, 1687, 24416, 9931, 35521, 24503, 65101, 17757,
+    13575, 13974, 17445, 23737, 49456, 1176, 67246, 20904, 66251, 24114,
+    23780, 11608, 45425, 20205, 22356, 40875, 21728, 59454, 54445, 20344,
+    3723, 4316, 1786, 38579, 40247, 9430, 0, 13480, 12058, 12130,
+    42436, 26437, 15756, 11555, 8596, 12680, 23352, 26196, 47489, 62821,
+    1287, 32440, 45891, 19440, 24630, 10325, 37204, 49150, 36979, 24650,
+    52283, 44409, 54679, 30659, 32076, 12641, 18182, 18617, 67230, 11703,
+    60278, 139, 9611, 47669, 55510, 26678, 17562, 23076, 24468, 38805,
+    7602, 6155, 30886, 65120, 39217, 43231, 42374, 17941, 66445, 16551,
+    6820, 45801, 66446, 56879, 31723, 3901, 59244, 45855, 38092, 35785,
+    33778, 27164, 19650, 36324, 21369, 59363, 65129, 27555, 27008, 11104,
+    43776, 29456, 64673, 59219, 45086, 32815, 14615, 65043, 3845, 59265,
+    28169, 62532, 35325, 48634, 55404, 19044, 24876, 54094, 25467, 55839,
+    27989, 26144, 35674, 16844, 28435, 25472, 21350, 56677, 62494, 67421,
+    42231, 48455, 18318, 26436, 64962, 17318, 32515, 29445, 38852, 20204,
+    133, 15131, 44459, 67023, 34364, 65100, 6554, 32970, 3745, 15325,
+    25639, 43898, 14447, 11631, 14955, 14130, 12958, 65247, 50977, 66313,
+    43240, 31810, 8135, 25770, 12359, 28958, 20568, 27067, 9092, 26639,
+    53230, 30489, 22620, 14928, 54550, 26903, 45140, 23526, 45094, 62733,
+    57503, 67757, 2445, 62874, 32796, 65103, 45359, 20182, 33158, 26566,
+    10515, 18282, 27280, 47471, 38401, 49285, 44675, 7225, 28940, 741,
+    65876, 66311, 20933, 62042, 39798, 38741, 6584, 22380, 21442, 0,
+    449, 13925, 67301, 27327, 12869, 23907, 23372, 27446, 24323, 52873,
+    8689, 57367, 66322, 32791, 6287, 36474, 16575, 34532, 63209, 42235,
+    0, 29346, 18908, 62768, 28013, 24139, 19544, 54605, 34450, 49537,
+    33232, 43478, 4069, 8862, 14105, 25675, 10381, 18527, 63683, 28154,
+    46119, 28776, 62719, 20814, 18462, 18541, 37734, 67856, 17704, 20299,
+    10310, 62283, 25042, 5981, 7569, 20092, 39750, 13204, 29156, 62735,
+    0, 28237, 49265, 2600, 49260, 50150, 16082, 22217, 5953, 15237,
+    32668, 28549, 7300, 44366, 43403, 24866, 54643, 5527, 48430, 25023,
+    42921, 62295, 42618, 34026, 27960, 39669, 31049, 41346, 66484, 27121,
+    46843, 22740, 29556, 47216, 37471, 59015, 14083, 26972, 37984, 28545,
+    6187, 66374, 46000, 15724, 58530, 27413, 32866, 35476, 31807, 28755,
+    36752, 0, 66339, 1516, 30288, 10983, 25644, 25122, 41182, 26246,
+    51513, 27232, 36102, 23500, 49452, 68066, 53952, 14728, 30479, 36785,
+    28187, 32976, 30027, 28811, 38281, 10733, 30854, 49476, 22626, 7841,
+    16899, 41940, 29823, 62672, 41955, 63973, 39001, 9461, 23424, 19542,
+    26856, 15184, 17570, 35706, 44645, 41267, 7410, 11304, 26803, 30324,
+    50604, 18828, 64810, 32219, 31039, 15559, 5522, 11261, 29711, 41616,
+    40620, 4121, 3109, 35854, 62788, 21594, 17172, 62878, 41794, 59247,
+    57817, 34173, 21640, 53522, 27207, 67471, 36911, 12726, 58761, 10858,
+    25810, 13551, 20997, 45056, 24330, 4361, 18016, 32285, 17378, 30290,
+    60027, 51846, 65033, 42473, 33851, 27284, 49619, 30609, 49241, 27862,
+    31691, 21458, 16152, 25511, 23370, 15577, 26410, 22774, 10754, 45608,
+    42242, 67387, 959, 46256, 30973, 52169, 31511, 65166, 12180, 22948,
+    0, 8420, 18334, 25753, 53223, 31513, 35933, 15766, 46357, 44928,
+    50451, 57931, 32943, 0, 65175, 27016, 15912, 0, 32409, 9823,
+    26976, 34289, 19755, 44226, 37330, 24506, 39921, 13543, 23302, 22219,
+    50485, 48407, 31717, 12253, 32162, 62129, 32363, 37989, 30050, 14567,
+    19881, 25935, 34234, 24778, 57380, 8746, 47718, 2553, 39226, 39872,
+    51224, 39755, 18599, 24639, 25865, 28819, 36362, 51121, 11999, 26972,
+    51117, 12691, 52092, 52944, 45612, 43849, 35213, 22054, 8803, 62777,
+    43527, 36898, 24549, 63426, 53331, 48725, 32025, 53416, 21389, 67340,
+    32073, 17992, 11855, 45255, 37734, 33263, 38037, 14452, 54212, 34422,
+    5222, 28064, 30828, 33002, 17747, 12277, 39570, 34349, 21041, 67446,
+    20277, 34356, 52483, 30840, 12771, 19376, 21047, 39901, 66495, 55971,
+    34398, 34903, 35044, 58690, 30307, 34799, 35015, 65144, 18724, 33894,
+    39162, 19275, 65151, 65139, 42202, 56697, 33648, 19990, 11469, 35101,
+    67510, 261, 27803, 35271, 35376, 13389, 45432, 21414, 44583, 5102,
+    66071, 7677, 31409, 4409, 59261, 341, 53233, 67482, 36982, 62870,
+    55292, 6840, 41687, 29987, 50224, 59033, 8295, 27516, 53619, 4045,
+    34214, 58456, 53997, 65191, 30809, 39128, 17714, 22995, 34057, 33054,
+    59223, 53055, 54643, 27691, 24465, 66547, 66561, 4892, 66523, 28351,
+    59217, 11233, 41665, 40380, 30017, 18432, 57622, 13157, 7927, 42485,
+    41557, 58447, 44963, 43449, 58269, 10103, 39851, 27969, 3089, 67278,
+    29696, 65273, 23875, 67945, 25393, 46853, 33965, 9791, 59445, 56675,
+    27809, 46916, 33267, 17025, 54782, 66634, 6002, 58820, 65408, 26269,
+    49409, 55202, 6929, 24162, 31460, 32380, 64890, 51204, 9148, 22832,
+    58479, 9760, 51095, 32277, 67519, 56992, 14794, 16027, 29873, 39193,
+    59853, 29195, 43090, 46408, 12021, 24404, 61934, 48347, 25540, 23215,
+    66661, 39049, 36903, 51131, 50496, 54642, 62732, 43089, 29055, 29594,
+    65326, 5803, 37838, 50793, 9559, 35016, 15384, 7992, 60228, 42865,
+    41375, 14755, 28122, 15568, 1023, 29641, 29965, 55949, 32114, 29264,
+    36155, 15835, 19890, 49869, 34630, 63806, 43506, 30216, 35083, 35833,
+    32678, 45147, 67029, 36047, 54418, 23334, 45826, 24296, 35888, 30714,
+    66461, 36435, 65326, 42192, 62929, 30933, 11807, 58084, 57653, 4879,
+    30929, 14710, 9443, 12191, 21046, 28476, 49616, 42689, 59291, 65330,
+    19886, 52741, 63564, 46916, 34348, 50880, 32258, 66492, 19689, 1,
+    42113, 50463, 8860, 20677, 63386, 45782, 33457, 33215, 53657, 36177,
+    29435, 14079, 39073, 9324, 53162, 40819, 66507, 23879, 45644, 39536,
+    39855, 21910, 46120, 7866, 51909, 43587, 38409, 62921, 41533, 20400,
+    36667, 54973, 50186, 126, 32024, 36317, 66485, 28759, 36188, 67467,
+    34352, 52948, 46110, 46760, 67510, 20371, 22362, 29929, 759, 14829,
+    62780, 26236, 50264, 55009, 51553, 42388, 37871, 36963, 19169, 36825,
+    49349, 32672, 29566, 5276, 67540, 5127, 45775, 1891, 19969, 66566,
+    11020, 57252, 60609, 19215, 39719, 41207, 19337, 56931, 41756, 57443,
+    58844, 33502, 12267, 59363, 6438, 26891, 3170, 66568, 47998, 27530,
+    46794, 33986, 111, 30491, 33370, 46582, 65180, 34516, 64677, 37323,
+    42428, 62982, 29023, 37802, 55961, 52466, 13806, 50025, 67354, 54728,
+    64370, 41206, 39611, 30721, 37097, 8973, 56404, 10425, 37533, 14474,
+    66365, 65400, 60763, 19744, 48679, 45165, 62952, 27786, 15711, 33954,
+    62968, 42672, 59246, 0, 7559, 53119, 13985, 23118, 30405, 43504,
+    13215, 35601, 35877, 58964, 1625, 47953, 25034, 44130, 44178, 65222,
+    22750, 51649, 39462, 67546, 29285, 5226, 3558, 50623, 34979, 36835,
+    35728, 23697, 66513, 48233, 36206, 13801, 10913, 37028, 62839, 43826,
+    59199, 20850, 10564, 22589, 65413, 48668, 58169, 59729, 28837, 24687,
+    29517, 40634, 42592, 36570, 35040, 49585, 26859, 62805, 30007, 21764,
+    64273, 66744, 34045, 46365, 35746, 30690, 25958, 63065, 46758, 52583,
+    49263, 51284, 35780, 5883, 24787, 60307, 67562, 18043, 58, 48304,
+    4183, 37260, 56185, 31677, 50817, 32100, 27150, 46853, 3356, 66747,
+    32427, 32011, 37886, 526, 32055, 55477, 68059, 50285, 67592, 60113,
+    37431, 25575, 50399, 58155, 56363, 32200, 8680, 16345, 56751, 7159,
+    13568, 28297, 62546, 64674, 11283, 47531, 65252, 29204, 23438, 40807,
+    38172, 34150, 59692, 57871, 67635, 17890, 31824, 36268, 40660, 64085,
+    47468, 12767, 65211, 46519, 25145, 42566, 1263, 57820, 39403, 65255,
+    13863, 32508, 60103, 65377, 38468, 65352, 67449, 42019, 64753, 34821,
+    41602, 5677, 53658, 60811, 41033, 45040, 37425, 12794, 54913, 41479,
+    63519, 31595, 56401, 53205, 54882, 481, 22864, 18329, 42636, 34070,
+    43471, 21942, 19130, 67456, 52038, 62870, 43934, 26797, 23033, 56030,
+    50461, 38408, 65173, 59253, 37962, 59376, 27427, 49995, 12041, 67631,
+    38463, 59554, 12061, 38277, 30104, 57038, 65376, 37810, 33454, 35172,
+    61569, 46928, 44628, 28164, 30399, 48115, 22211, 67688, 4752, 67327,
+    51754, 67401, 66684, 66663, 403, 1201, 52605, 10090, 67281, 63069,
+    268, 63002, 14916, 46963, 66777, 50227, 4459, 25355, 58602, 25564,
+    16109, 7169, 33024, 58401, 37978, 67217, 62953, 24268, 63063, 30002,
+    64898, 34, 59312, 24193, 66507, 17865, 63033, 15995, 1342, 38049,
+    58600, 38252, 48894, 21568, 23722, 40248, 64382, 41546, 67700, 30378,
+    4941, 49408, 5149, 66576, 60711, 60054, 67413, 51853, 28564, 41034,
+    22403, 13342, 42210, 27311, 31575, 57206, 31498, 44492, 65423, 15067,
+    33729, 14924, 56283, 23294, 26644, 39638, 63077, 17179, 58288, 11947,
+    22886, 38436, 59282, 25506, 36954, 62661, 65432, 21623, 30128, 13188,
+    41, 35728, 62007, 51664, 26112, 34068, 22591, 15560, 63421, 40407,
+    9482, 34556, 20201, 67668, 59271, 66684, 17013, 42147, 20537, 42538,
+    31610, 52361, 59344, 36863, 43995, 38663, 54814, 15792, 44321, 6899,
+    62015, 7408, 51167, 67148, 59457, 19593, 37607, 2439, 34132, 66612,
+    52316, 63074, 38012, 59599, 34880, 30298, 42781, 68010, 39477, 26439,
+    22165, 15032, 34095, 36909, 51668, 57620, 65489, 51420, 38642, 41318,
+    47521, 38606, 59296, 26461, 66491, 68139, 57364, 32300, 48926, 68140,
+    42831, 29024, 20985, 9484, 22266, 43263, 50954, 67694, 39359, 54349,
+    40548, 21475, 37987, 42945, 36131, 6278, 37316, 54772, 57130, 66688,
+    31041, 59456, 35235, 63004, 54124, 67855, 31228, 43302, 54492, 55869,
+    37767, 50118, 38198, 7150, 13219, 60991, 62761, 47073, 30210, 975,
+    59540, 21037, 12953, 5977, 4462, 62899, 63847, 50943, 21123, 66763,
+    36856, 63119, 11481, 30417, 28705, 11132, 21102, 65562, 36196, 53181,
+    16482, 65515, 45364, 47149, 36782, 30844, 42310, 36273, 62735, 63684,
+    7234, 52291, 14547, 64862, 3611, 32491, 62976, 944, 67658, 38330,
+    47429, 0, 67690, 67651, 33095, 32917, 0, 38261, 59746, 55188,
+    37436, 6911, 33325, 63088, 57079, 65226, 67955, 65906, 38814, 28490,
+    33886, 67352, 37423, 66214, 25919, 65584, 47410, 62048, 67256, 2893,
+    10795, 33835, 67370, 8619, 63062, 35125, 65565, 52061, 58488, 41471,
+    58388, 58384, 65456, 51608, 65318, 18443, 13459, 66822, 1637, 38377,
+    16498, 66591, 51866, 62930, 44481, 65497, 61691, 43075, 4483, 22700,
+    46316, 59484, 37951, 3839, 55187, 65163, 67382, 59462, 53945, 67574,
+    41304, 38406, 65439, 40266, 27737, 46824, 66733, 39081, 49378, 44256,
+    18205, 7136, 58940, 36584, 48293, 53191, 52860, 42158, 37421, 41726,
+    32237, 68235, 18405, 64965, 50461, 65534, 39178, 418, 2798, 60292,
+    35402, 28559, 55404, 64957, 6126, 36964, 67395, 6980, 49056, 40701,
+    56970, 42894, 30260, 67677, 39191, 39420, 60789, 67732, 65594, 39544,
+    49800, 15339, 65615, 67752, 61313, 22848, 16617, 32482, 42008, 23431,
+    44328, 19644, 46120, 59338, 18077, 38818, 39187, 37981, 49017, 29721,
+    60922, 4293, 35059, 63259, 28335, 53687, 24947, 32997, 17037, 33838,
+    52560, 46356, 40525, 31910, 63113, 65038, 53398, 44997, 66784, 42029,
+    52716, 19076, 20701, 50739, 57818, 38907, 54973, 15430, 47708, 34869,
+    57763, 59472, 32491, 51568, 40379, 32925, 63985, 65638, 29368, 25796,
+    55678, 14244, 16218, 19267, 31620, 59298, 61572, 36072, 67530, 55495,
+    67801, 52418, 24009, 67595, 55224, 36483, 59458, 68182, 43038, 10806,
+    65642, 39823, 5398, 18240, 60802, 24608, 65576, 27597, 54137, 40487,
+    65452, 19113, 42319, 48329, 22297, 34069, 23151, 42620, 52693, 35302,
+    23836, 51778, 67775, 15997, 2305, 6999, 44084, 11657, 10370, 25958,
+    60776, 62900, 49665, 33748, 14405, 31327, 38709, 36365, 49293, 42109,
+    9624, 61021, 28609, 57892, 65538, 29956, 52498, 172, 13532, 60086,
+    24953, 67723, 49505, 25720, 52726, 63086, 7521, 38415, 48133, 62324,
+    27567, 65662, 19575, 63193, 61323, 20149, 17859, 59428, 60337, 1710,
+    1260, 53437, 49419, 30747, 14413, 22513, 52382, 37676, 40085, 32735,
+    36968, 16671, 66523, 38587, 65624, 30332, 66465, 36732, 62837, 67935,
+    19968, 66443, 48931, 2957, 45331, 50422, 5, 16851, 65605, 54890,
+    34912, 48923, 49511, 20780, 61981, 53263, 68115, 33504, 31310, 68051,
+    66868, 66685, 67703, 7362, 68158, 63275, 58753, 58, 3891, 36391,
+    12, 15802, 30392, 44089, 66884, 19307, 9583, 31502, 6175, 42010,
+    15110, 29376, 23060, 31700, 55835, 21216, 68199, 39981, 39767, 67421,
+    42343, 62291, 30666, 65588, 12284, 56189, 63950, 19496, 67763, 43118,
+    39886, 65417, 39826, 48591, 67462, 22578, 62999, 47531, 65603, 30836,
+    3260, 34111, 50450, 3633, 47254, 54732, 60954, 40021, 26322, 62843,
+    28876, 65419, 53582, 43000, 67624, 65316, 25739, 55671, 57697, 27725,
+    54409, 36109, 61978, 60758, 22539, 68117, 39979, 66610, 21779, 57685,
+    29580, 15352, 66778, 12572, 44846, 5410, 23391, 67630, 30806, 36833,
+    33190, 63267, 58199, 43986, 43332, 17637, 65500, 32417, 1400, 53726,
+    60862, 61036, 60278, 14933, 29081, 56945, 68223, 56849, 24818, 55399,
+    40473, 20761, 32017, 6058, 64398, 60196, 0, 55944, 56107, 66838,
+    57180, 57714, 13193, 62261, 15217, 31634, 40490, 29925, 34300, 41053,
+    35993, 25222, 60369, 35851, 63171, 35797, 11139, 11826, 53032, 66747,
+    63171, 37454, 9295, 58351, 55925, 53042, 68407, 52276, 40308, 35994,
+    41223, 66835, 40487, 67581, 51550, 66797, 53539, 5505, 67432, 63042,
+    41443, 10594, 56116, 64373, 54130, 11982, 23013, 68142, 63227, 23956,
+    57222, 47911, 40875, 29294, 67689, 54055, 906, 12566, 45770, 40009,
+    46487, 19986, 62767, 38433, 8244, 66831, 59235, 59466, 47698, 13320,
+    28457, 51378, 41481, 59541, 68019, 25841, 27687, 54880, 50850, 63318,
+    9709, 56916, 41433, 52468, 65374, 17333, 66495, 52027, 61480, 46561,
+    14048, 30384, 63136, 37074, 8159, 39355, 54417, 41557, 17848, 31584,
+    63789, 52355, 60490, 1538, 38300, 39729, 36127, 38863, 32931, 67720,
+    38966, 20551, 52450, 45497, 0, 46069, 0, 65461, 66878, 41310,
+    39321, 33340, 66442, 47408, 34395, 41705, 66877, 54580, 32404, 38768,
+    53825, 53349, 59576, 41942, 27559, 37552, 68061, 40136, 6520, 66334,
+    66903, 34270, 38456, 66897, 8705, 21567, 67640, 65733, 36381, 66909,
+    44468, 56112, 21461, 33902, 38702, 44602, 40285, 67927, 40988, 44428,
+    37918, 58791, 8871, 6502, 54383, 41935, 46213, 41275, 11923, 20450,
+    57183, 67648, 24957, 42125, 66848, 9235, 26192, 40077, 8782, 25740,
+    27342, 61798, 58708, 55726, 32789, 7683, 5659, 40473, 36924, 60563,
+    51325, 40923, 67809, 60320, 55018, 29180, 50136, 59688, 43253, 67676,
+    39036, 27083, 31156, 30836, 37906, 43756, 35963, 45841, 67769, 42082,
+    39679, 65405, 61050, 0, 68227, 68108, 67500, 18352, 53461, 56800,
+    56681, 41830, 54764, 61249, 65519, 68175, 29542, 46055, 14782, 28473,
+    50224, 48899, 42216, 43121, 39586, 23240, 34784, 68241, 67923, 68146,
+    14934, 23238, 67680, 66723, 43500, 30069, 49411, 63046, 45606, 30055,
+    61859, 57818, 59590, 60363, 42864, 67887, 13584, 33726, 21711, 45071,
+    36825, 67582, 67740, 0, 23663, 58785, 53442, 35402, 23471, 65444,
+    63323, 66710, 24988, 65681, 25165, 65550, 12882, 18513, 62366, 47914,
+    41768, 52725, 25661, 63026, 67810, 13973, 43914, 51610, 55816, 66654,
+    4319, 60008, 49493, 54360, 67832, 66767, 9417, 41897, 54014, 42437,
+    65486, 37483, 40308, 1854, 36532, 21446, 34680, 50177, 48256, 53009,
+    40388, 52937, 6666, 56703, 23736, 65635, 47413, 10521, 42174, 21096,
+    41598, 17218, 67696, 37779, 36248, 65756, 65764, 38799, 13819, 62417,
+    67848, 60667, 68189, 31655, 13234, 40535, 66827, 60223, 52927, 40820,
+    63106, 32387, 65710, 66835, 52462, 57767, 49261, 154, 67697, 45291,
+    67778, 27699, 16714, 49476, 65595, 63264, 62814, 67608, 44888, 65405,
+    54944, 48522, 64529, 51192, 42820, 51564, 68170, 51772, 11322, 64614,
+    64817, 41863, 3319, 39146, 59559, 6751, 45289, 60128, 41142, 50902,
+    23530, 41093, 66919, 41426, 68141, 27349, 42103, 7573, 61500, 15360,
+    16532, 11751, 38740, 38583, 66934, 42506, 60419, 27859, 65684, 66999,
+    68286, 66814, 19593, 67674, 0, 67725, 40346, 59630, 46540, 42579,
+    10883, 43004, 46051, 43416, 18073, 41371, 5312, 43060, 50948, 56490,
+    16734, 26879, 43966, 51720, 66876, 43091, 9, 65625, 62886, 63846,
+    63651, 5831, 24185, 34551, 68247, 43799, 24242, 48233, 16316, 47533,
+    68214, 55962, 36273, 33489, 66946, 58049, 67548, 6320, 55450, 52346,
+    252, 66992, 62339, 60188, 49028, 28161, 65668, 52436, 65764, 41979,
+    58923, 68170, 43295, 37048, 40672, 63705, 24175, 43175, 45042, 60291,
+    47941, 29525, 45767, 2589, 42513, 15905, 43479, 54744, 46691, 59029,
+    0, 68174, 5518, 66159, 39718, 0, 35131, 5655, 54166, 12385,
+    35096, 33996, 44669, 32152, 48297, 43497, 67661, 0, 44921, 46507,
+    63141, 43489, 45985, 38930, 14043, 54895, 28069, 35467, 51619, 63835,
+    62843, 45026, 38653, 30101, 43799, 41888, 0, 26175, 68184, 49309,
+    55510, 31448, 36184, 63228, 52955, 67697, 4394, 27884, 67773, 54206,
+    11038, 63713, 67789, 68215, 34865, 43079, 39194, 20983, 58387, 39412,
+    48539, 31320, 65686, 34551, 66893, 60816, 68219, 55156, 61612, 68214,
+    44056, 48200, 44957, 68227, 10274, 5386, 43823, 50907, 42939, 55214,
+    43254, 43623, 42250, 14372, 43828, 68114, 48836, 39856, 13033, 43911,
+    26307, 68113, 24736, 54970, 52146, 21698, 47527, 24516, 67827, 64205,
+    67855, 43642, 33557, 54044, 67801, 46399, 34449, 43895, 46935, 14696,
+    65237, 62458, 45388, 46413, 22360, 61972, 28650, 58158, 68236, 61413,
+    44164, 41072, 48754, 67844, 42222, 13127, 44252, 59707, 0, 40763,
+    39263, 46785, 59207, 41533, 68254, 44419, 65671, 61398, 67818, 45561,
+    68241, 59534, 46022, 53110, 48188, 31404, 26179, 67066, 67059, 44060,
+    47598, 67896, 67921, 68275, 48741, 45710, 33106, 5736, 46144, 53900,
+    68250, 67950, 40558, 7746, 68271, 23651, 68134, 47500, 55756, 41082,
+    67905, 61589, 45358, 42037, 39335, 63789, 47173, 47376, 67878, 0,
+    48275, 58773, 66148, 43566, 45283, 45583, 64319, 36508, 47012, 68172,
+    47503, 57997, 42784, 36740, 49138, 67807, 57481, 66875, 27386, 67929,
+    46726, 63416, 53020, 47495, 68339, 47737, 45987, 34572, 66043, 68284,
+    44549, 42095, 50247, 42704, 36010, 67720, 67921, 0, 7068, 68191,
+    4963, 50437, 48847, 66833, 61591, 58821, 47785, 48605, 68190, 47641,
+    48079, 48767, 40905, 45883, 6975, 44749, 38283, 30771, 44072, 23186,
+    2494, 57998, 34706, 65429, 42024, 22644, 44564, 64343, 62777, 52191,
+    45352, 68091, 68387, 65290, 54907, 33278, 27979, 67065, 68377, 42750,
+    43287, 59820, 40913, 48178, 20009, 35784, 67939, 44548, 44451, 51342,
+    47339, 66965, 41714, 67633, 68344, 56506, 39565, 50546, 68174, 16775,
+    56391, 32200, 44594, 43187, 0, 2776, 0, 66800, 43307, 42367,
+    68115, 27940, 67499, 3567, 50532, 64494, 41386, 8735, 46653, 39558,
+    43841, 54505, 65849, 35904, 56507, 44827, 47702, 46641, 64145, 49209,
+    66938, 47983, 8078, 37961, 55419, 65785, 68154, 68272, 66588, 4568,
+    61943, 12762, 59403, 45143, 45132, 33239, 44229, 68271, 67839, 65789,
+    47022, 89, 48930, 66941, 63272, 44229, 42854, 33442, 57280, 48081,
+    21806, 65204, 68306, 25630, 62895, 18943, 67932, 59122, 22250, 46866,
+    18465, 16090, 19435, 57574, 52001, 67098, 43224, 27486, 41187, 66924,
+    47793, 62418, 68366, 25718, 68297, 24802, 45852, 65861, 68274, 59573,
+    43417, 33553, 65945, 67882, 51158, 51669, 63595, 48139, 43968, 0,
+    68349, 68243, 67798, 44619, 40637, 42530, 15431, 57610, 68023, 67955,
+    29577, 50224, 67858, 4611, 9674, 66995, 68289, 64993, 58639, 67893,
+    11724, 66680, 48477, 9608, 52503, 39902, 49694, 2206, 67850, 55553,
+    52535, 67864, 67040, 43629, 49492, 5, 53241, 67834, 48413, 8497,
+    67095, 0, 65666, 50139, 66984, 49315, 63427, 44343, 8022, 67609,
+    33541, 7802, 60578, 58530, 61446, 44960, 31266, 68037, 68341, 67800,
+    45054, 22929, 2799, 30769, 45394, 65780, 63194, 67962, 1969, 35156,
+    45416, 68107, 45409, 34732, 25841, 36653
+};
+
+unsigned int rank_offsets7[] =
+{
+    41104, 27985, 54945, 20697, 40934, 42570, 63328, 8183, 54555, 31960,
+    63050, 556, 38393, 32240, 49592, 42669, 49476, 5615, 30646, 49317,
+    42463, 42500, 42638, 31860, 27945, 59570, 35477, 12515, 14670, 61242,
+    17930, 59561, 54972, 2435, 7257, 18398, 9419, 54767, 18918, 5141,
+    64, 35363, 2373, 1698, 54846, 2263, 54971, 14664, 35779, 28039,
+    59342, 42712, 16584, 28208, 28198, 42353, 13372, 14895, 49329, 14764,
+    59433, 27914, 42632, 21386, 5690, 3989, 42671, 27496, 2592, 45995,
+    20731, 42803, 4887, 7249, 35467, 65816, 28230, 18791, 49433, 49599,
+    49336, 28845, 27570, 15473, 68007, 36653, 27187, 42692, 55092, 14839,
+    35435, 35516, 68008, 9423, 35535, 20784, 2500, 49456, 45350, 11565,
+    45571, 49611, 54327, 65869, 41875, 14559, 40810, 23263, 35346, 59746,
+    14856, 67110, 9547, 54909, 28192, 59114, 42699, 54895, 19147, 3864,
+    59725, 28147, 42766, 48721, 42794, 47052, 63073, 42889, 39000, 28036,
+    63314, 35526, 25072, 792, 50171, 28249, 25960, 23259, 40347, 55082,
+    26551, 28287, 49464, 35419, 20524, 42956, 43057, 63393, 20813, 43000,
+    28377, 67040, 14991, 59833, 28405, 54745, 55004, 49533, 55090, 52839,
+    42830, 3752, 35551, 28363, 59808, 35511, 39752, 15040, 49625, 28276,
+    1067, 28058, 49709, 17442, 39801, 28483, 59024, 55112, 10567, 19069,
+    63029, 59642, 38468, 63355, 42656, 779, 14269, 51767, 28451, 51532,
+    10633, 63505, 49320, 33496, 14799, 67069, 5274, 55185, 13119, 66879,
+    43093, 59744, 55139, 28524, 36470, 35367, 26385, 28488, 46132, 54828,
+    63236, 15163, 43132, 55123, 66882, 15105, 28235, 5902, 7533, 3023,
+    9631, 2663, 42024, 54920, 49596, 15042, 28622, 63412, 20912, 55038,
+    4292, 49640, 56974, 58385, 20576, 63464, 49643, 43080, 35579, 42797,
+    4012, 20026, 15230, 55212, 59456, 43032, 49783, 9600, 55216, 49820,
+    49728, 2965, 3453, 3303, 55161, 17102, 39818, 43191, 65724, 9677,
+    6947, 42964, 25518, 43390, 34523, 20811, 54877, 66987, 14957, 5849,
+    5649, 9286, 20881, 28631, 49810, 59550, 28571, 21560, 35507, 67033,
+    34827, 63515, 10534, 66946, 33612, 25498, 67204, 1652, 43675, 49541,
+    55184, 55266, 55102, 9735, 18852, 2950, 59826, 49512, 28321, 15084,
+    35987, 20920, 45316, 35573, 21039, 2807, 14550, 35617, 63459, 43041,
+    49840, 33887, 6094, 43195, 15151, 59857, 15307, 17035, 12, 35549,
+    34708, 35754, 35475, 6532, 28696, 20322, 15237, 23202, 49203, 21684,
+    55316, 20992, 7246, 43220, 42807, 9764, 24657, 9589, 24224, 59904,
+    28654, 49842, 53356, 21165, 7196, 35608, 32304, 15452, 9853, 28674,
+    49752, 65976, 35618, 27697, 21164, 39403, 43007, 59822, 28797, 56315,
+    35667, 54999, 33593, 59833, 35808, 35620, 20802, 43126, 49820, 15268,
+    24745, 15146, 32129, 22004, 9045, 195, 12639, 26879, 10109, 21011,
+    61403, 46911, 67969, 15395, 30935, 35841, 1703, 59915, 35596, 59771,
+    28724, 55341, 28656, 63331, 30083, 3913, 3668, 28727, 5772, 3680,
+    6060, 47897, 5887, 43280, 55307, 35694, 56796, 35700, 49901, 27860,
+    59755, 9876, 9015, 30840, 35858, 28863, 43147, 2562, 41441, 103,
+    6609, 5944, 29040, 28888, 43122, 28947, 43213, 49973, 49916, 13728,
+    29007, 29913, 43332, 14455, 28849, 6394, 1121, 59103, 3022, 21221,
+    21416, 55017, 8798, 49959, 28897, 43155, 140, 43357, 55407, 4145,
+    55199, 25448, 39587, 35830, 65807, 6134, 26928, 15536, 5740, 28946,
+    52127, 6222, 55303, 24538, 12561, 35841, 43227, 49942, 22359, 43297,
+    9560, 65902, 35888, 36411, 15493, 59852, 2899, 11449, 15977, 2526,
+    43323, 43133, 28805, 19578, 43239, 45007, 43384, 55443, 38243, 5647,
+    59521, 35894, 50011, 29065, 34382, 1130, 21255, 21212, 28912, 4998,
+    35879, 9984, 55396, 36009, 48151, 9852, 26447, 15531, 43305, 55507,
+    15499, 55434, 10052, 63565, 21053, 43529, 15622, 20978, 3161, 55153,
+    15674, 2978, 15706, 30337, 10150, 31161, 21221, 9960, 29130, 2058,
+    55511, 36031, 29175, 29090, 26718, 8121, 43439, 3131, 53321, 36170,
+    34201, 607, 55244, 9667, 24178, 29087, 21315, 55417, 15340, 3155,
+    49915, 55246, 13769, 6765, 10032, 49949, 50031, 59800, 10225, 44484,
+    6118, 63300, 35821, 36023, 36120, 55412, 49953, 49839, 36125, 55518,
+    43546, 15637, 36186, 43437, 36117, 21211, 59990, 1218, 27995, 15358,
+    9549, 36241, 21639, 21058, 55540, 21322, 62958, 67192, 55404, 50064,
+    44424, 13727, 17034, 43475, 1270, 4847, 3202, 43669, 29126, 26645,
+    28995, 107, 1472, 55387, 27363, 36279, 43647, 59796, 29172, 55535,
+    63510, 55644, 59875, 1488, 29203, 10152, 36232, 29317, 50072, 1503,
+    50053, 8772, 52144, 43687, 22422, 1422, 55647, 29323, 55702, 46648,
+    5995, 59887, 808, 16495, 36374, 35389, 29376, 13849, 10239, 50191,
+    43276, 33429, 29405, 63436, 10280, 29691, 21254, 10326, 1272, 43560,
+    29923, 29239, 8771, 43708, 16211, 6280, 50086, 8255, 67145, 10444,
+    50119, 6274, 63561, 28029, 55072, 36309, 65642, 50124, 10346, 10358,
+    40777, 11879, 21368, 10494, 6309, 63531, 43633, 55610, 801, 2881,
+    34379, 8795, 29508, 67159, 43741, 36023, 36327, 17668, 2423, 14501,
+    15804, 21408, 50169, 36350, 63631, 9202, 3290, 29319, 63635, 21490,
+    59852, 29409, 55725, 6500, 43563, 98, 60031, 23632, 13312, 15786,
+    50018, 43712, 254, 59966, 43614, 50058, 29549, 63621, 15579, 59912,
+    29579, 28383, 6357, 29500, 29659, 17987, 118, 43674, 36354, 50203,
+    23800, 10371, 29415, 43852, 4431, 43832, 63415, 10486, 11342, 55655,
+    29490, 15729, 55077, 21634, 55663, 6044, 29594, 36487, 9522, 43779,
+    18047, 43897, 35870, 15656, 15902, 12066, 36452, 21312, 21668, 20471,
+    15892, 67225, 1546, 63583, 43924, 50092, 29684, 36265, 26978, 11825,
+    50364, 15950, 36374, 63405, 21693, 10425, 36074, 15993, 60085, 3200,
+    40588, 10457, 20090, 36439, 63233, 36477, 60042, 36553, 44049, 20669,
+    55606, 44004, 34980, 50027, 55659, 59995, 21552, 55533, 29447, 23291,
+    6541, 23446, 21624, 60032, 29695, 9025, 36638, 59747, 29754, 61837,
+    50289, 54435, 36581, 29744, 63601, 50215, 43766, 21441, 50193, 1673,
+    43951, 21653, 44106, 29836, 29852, 3217, 18014, 6199, 10538, 10808,
+    29821, 21804, 42910, 21153, 29476, 59865, 36563, 30397, 15773, 36631,
+    50238, 55615, 36709, 50194, 3311, 58122, 15919, 50357, 21768, 60069,
+    3628, 5886, 55653, 10557, 36597, 10574, 26114, 43684, 44088, 21855,
+    43947, 16145, 22182, 21605, 50429, 10586, 59938, 166, 22183, 15802,
+    36719, 44021, 6453, 16021, 14825, 2452, 22022, 55715, 3080, 55791,
+    21839, 60035, 36676, 55681, 1694, 60038, 29847, 33402, 44013, 43914,
+    3233, 55564, 16115, 58716, 55563, 29864, 55010, 21869, 8528, 50120,
+    67182, 21787, 12474, 1684, 53519, 50402, 50248, 44229, 55739, 16128,
+    59953, 50285, 60077, 31401, 29996, 44057, 36816, 36831, 29746, 59351,
+    1753, 12250, 3120, 10686, 50406, 50471, 3373, 21938, 6722, 50411,
+    44179, 1488, 16073, 63394, 44128, 50509, 30024, 10613, 11061, 15967,
+    55842, 36738, 46064, 45987, 36393, 3328, 65698, 36845, 30046, 16380,
+    50498, 1710, 44247, 36794, 50557, 55722, 11531, 29831, 29888, 24623,
+    22025, 44379, 6678, 36904, 6555, 24797, 30059, 25570, 10903, 50558,
+    11375, 31352, 14299, 29947, 50629, 43696, 12603, 55903, 63728, 10729,
+    844, 3379, 44081, 22035, 55657, 1516, 1704, 21824, 14709, 30181,
+    59954, 45832, 59932, 50632, 5352, 31521, 67214, 60154, 36722, 44255,
+    9171, 43955, 3403, 65809, 6504, 50704, 22096, 21139, 30118, 31823,
+    22102, 40910, 50656, 55906, 59507, 60049, 16192, 31506, 6703, 25839,
+    36881, 6408, 50684, 6755, 44432, 10914, 22882, 3572, 3615, 3451,
+    50574, 55811, 44262, 10966, 44233, 36894, 30110, 50703, 22079, 55834,
+    38962, 44315, 9705, 60108, 16377, 55941, 21943, 37067, 30073, 55840,
+    22169, 525, 16116, 50741, 22212, 21982, 36858, 10869, 22261, 16301,
+    44250, 1662, 50775, 16390, 50679, 19234, 36912, 22314, 42291, 5085,
+    46263, 16304, 17, 22188, 50396, 36940, 30222, 22342, 3656, 871,
+    6774, 30243, 10959, 44217, 30233, 36699, 22388, 63606, 10873, 63671,
+    48390, 33053, 30283, 67052, 44399, 9841, 55677, 36930, 49373, 15360,
+    7935, 29264, 50339, 3669, 3853, 16400, 65973, 30412, 50829, 16572,
+    65950, 47265, 50820, 13763, 36931, 44437, 15700, 36943, 50673, 55690,
+    16708, 44467, 10921, 65902, 30322, 48170, 6766, 55887, 22131, 37141,
+    6825, 30611, 22285, 44476, 1955, 24210, 34358, 55859, 46860, 30211,
+    50771, 44211, 60108, 3817, 57357, 16478, 9663, 16612, 43556, 22366,
+    44306, 3874, 44439, 36922, 10719, 22435, 10070, 22236, 4508, 50860,
+    10949, 31534, 10832, 51206, 7607, 44596, 11117, 60039, 6938, 60200,
+    22554, 44494, 44516, 30385, 10989, 36974, 37193, 37226, 50887, 3870,
+    44598, 16590, 40155, 30162, 37015, 3755, 29359, 11124, 52637, 37289,
+    65708, 44838, 45682, 11229, 55863, 63605, 30429, 30290, 22281, 44591,
+    60269, 55856, 37115, 34716, 22406, 33329, 11058, 63596, 22592, 66024,
+    329, 1125, 30129, 44709, 60219, 11067, 60301, 56039, 44538, 50985,
+    15149, 24110, 13534, 30523, 50684, 36931, 63659, 0, 51006, 11206,
+    56064, 44677, 16491, 37305, 55937, 30465, 55939, 44750, 44800, 51007,
+    22551, 50916, 56067, 60051, 37407, 65930, 6845, 57078, 50765, 30560,
+    11517, 55752, 11352, 56202, 3963, 16107, 37117, 22565, 22577, 37144,
+    60094, 22640, 60226, 3889, 36468, 30071, 44710, 51010, 22790, 30527,
+    44799, 3961, 44263, 37434, 50883, 11264, 29597, 2204, 30344, 63682,
+    6915, 56010, 16456, 51049, 30374, 63487, 44809, 50856, 22644, 37805,
+    60186, 63448, 30506, 15623, 55936, 31527, 25500, 63661, 63593, 30354,
+    29152, 20670, 63630, 6539, 60279, 16703, 19695, 12507, 60215, 32653,
+    10019, 5260, 51143, 44563, 63815, 56214, 60323, 44629, 51001, 44875,
+    56278, 56140, 50965, 37521, 22622, 44846, 11477, 60440, 730, 60448,
+    11143, 44741, 37342, 41727, 44978, 56182, 37380, 44805, 44942, 9518,
+    50923, 59995, 37360, 44589, 13295, 11333, 54483, 11405, 1562, 22245,
+    50798, 37452, 60252, 205, 50366, 44816, 30600, 51154, 6194, 6931,
+    30810, 37633, 45062, 42247, 6987, 56182, 37456, 60163, 30727, 65988,
+    7057, 37433, 6145, 54033, 51097, 7048, 11396, 25160, 16562, 16892,
+    51122, 16752, 7561, 30617, 8139, 37487, 5007, 42, 12745, 37547,
+    60283, 44918, 67069, 37588, 68047, 30630, 10071, 40578, 37623, 60329,
+    44941, 10573, 44955, 34674, 11512, 51269, 52670, 73, 7514, 56144,
+    16754, 68044, 30731, 63675, 22707, 34279, 4656, 56134, 56292, 37724,
+    19671, 30937, 1084, 25614, 22838, 45169, 45110, 45202, 56245, 16961,
+    67206, 22671, 17261, 7174, 3099, 7854, 37781, 11597, 56127, 51201,
+    22795, 16983, 37643, 50998, 60404, 56318, 22922, 56058, 50929, 39117,
+    37534, 56111, 30654, 63709, 22685, 39639, 37395, 22786, 23106, 63727,
+    1406, 56158, 41421, 11649, 28717, 60266, 5414, 16936, 56442, 17000,
+    43392, 22898, 51145, 37758, 56316, 18228, 45122, 11557, 41055, 1466,
+    37796, 23005, 37562, 51336, 37695, 30867, 993, 51123, 1802, 31128,
+    26765, 56076, 37557, 42817, 30930, 63734, 44550, 63764, 56348, 67073,
+    37769, 63361, 12663, 24092, 50874, 11647, 63705, 23008, 37836, 4926,
+    60483, 2093, 56289, 16783, 56345, 15373, 37051, 3325, 66038, 23143,
+    6906, 45249, 15910, 50932, 45009, 15437, 37869, 17467, 11668, 51323,
+    1019, 51289, 37821, 51215, 11928, 60321, 16884, 63806, 37825, 17762,
+    45075, 51264, 23114, 56423, 60324, 55909, 60532, 11557, 65903, 51120,
+    36310, 45162, 65876, 3865, 65855, 499, 37953, 56280, 56324, 23154,
+    22965, 17003, 63505, 56509, 2076, 30713, 33650, 56357, 37964, 9273,
+    921, 68087, 23316, 6353, 31012, 60409, 45043, 14323, 11714, 56322,
+    51256, 16821, 17073, 11784, 23124, 17378, 37918, 3797, 56419, 11851,
+    50738, 30757, 67145, 37927, 55246, 17216, 27578, 45027, 34322, 51389,
+    29046, 51211, 37944, 14088, 5680, 42861, 22859, 42152, 8226, 45287,
+    51438, 32803, 23220, 51447, 17199, 67198, 25957, 66045, 7072, 51469,
+    14968, 51545, 56550, 38074, 20403, 37630, 9881, 23272, 45233, 5619,
+    60544, 6780, 45148, 30721, 50431, 12055, 39218, 7233, 18655, 45336,
+    38034, 45279, 37836, 60477, 56560, 30759, 26336, 63613, 29177, 5195,
+    45176, 17061, 38032, 63729, 11731, 63702, 37883, 13755, 31146, 27724,
+    44498, 38209, 21457, 17483, 4437, 51384, 38226, 17247, 56504, 51500,
+    55056, 278, 51409, 38121, 45370, 23168, 51060, 38241, 45471, 31155,
+    11907, 23174, 38580, 38334, 30677, 394, 30937, 5504, 23391, 60516,
+    7306, 56636, 37997, 51361, 9792, 12190, 31034, 56590, 60397, 20131,
+    31179, 65930, 5633, 65850, 56006, 13294, 56089, 11625, 39236, 31059,
+    1681, 12142, 63822, 38270, 45555, 11797, 38247, 38381, 65649, 3689,
+    41610, 20113, 56682, 56691, 51551, 45493, 4267, 56580, 38232, 49667,
+    7014, 53213, 51593, 24662, 26072, 56503, 12241, 63862, 31024, 60496,
+    49069, 44832, 56631, 51631, 56658, 22331, 60539, 23377, 6834, 60412,
+    56724, 38800, 51377, 31213, 64354, 38310, 20724, 23229, 51667, 17354,
+    51579, 38362, 38483, 17782, 4067, 31300, 51693, 31337, 31407, 38191,
+    33441, 38436, 1799, 58732, 12131, 27269, 7307, 60107, 12156, 23398,
+    38409, 22728, 51530, 12244, 17260, 51697, 23290, 8577, 45081, 31401,
+    45069, 17278, 60536, 12302, 17042, 31189, 66037, 18548, 12608, 63887,
+    51597, 45480, 59901, 21447, 60572, 51422, 12169, 45590, 38456, 56700,
+    51655, 67273, 502, 56731, 38548, 15549, 47766, 30959, 23475, 67232,
+    60458, 59698, 45434, 45435, 37988, 19821, 60560, 41286, 60549, 7338,
+    3165, 672, 23544, 51732, 51820, 45673, 46443, 12234, 43611, 45395,
+    60740, 45584, 49539, 23430, 45456, 6166, 50810, 54677, 31258, 32030,
+    45153, 33428, 28965, 26799, 14232, 63720, 6417, 14644, 8539, 67147,
+    17052, 60719, 17273, 45559, 32332, 17303, 51415, 9279, 38640, 51718,
+    56418, 17496, 31499, 31392, 60663, 51735, 45667, 17529, 60777, 7255,
+    25901, 45589, 29062, 51763, 7364, 4038, 56672, 35005, 45789, 19497,
+    7426, 16528, 8031, 45764, 17502, 63879, 38393, 19638, 43292, 32214,
+    36876, 63609, 9047, 45612, 10324, 63965, 60623, 38503, 45664, 19115,
+    56796, 2450, 46857, 31305, 15758, 23381, 60649, 65997, 68375, 23618,
+    45554, 38574, 63930, 6050, 56787, 17583, 60653, 51643, 45651, 31520,
+    31411, 68423, 38632, 60770, 35311, 6722, 42828, 60869, 7579, 38611,
+    38721, 35123, 17463, 56735, 17097, 60815, 56730, 11679, 38760, 33052,
+    28597, 56740, 63961, 60770, 64546, 60764, 45834, 17507, 4557, 45749,
+    11736, 624, 38660, 23616, 45869, 23670, 38817, 23637, 45847, 3985,
+    38862, 30922, 31524, 8706, 23625, 27773, 8187, 14367, 17690, 4691,
+    23652, 24097, 23780, 23809, 31629, 36816, 23457, 31633, 45670, 60871,
+    2175, 4077, 12258, 38825, 11190, 12438, 60668, 4111, 63843, 44213,
+    51801, 12429, 40077, 15426, 60852, 31568, 20156, 60675, 56576, 38788,
+    51744, 23399, 12425, 37468, 17471, 27186, 12396, 23880, 14494, 953,
+    23904, 60958, 5202, 60928, 19058, 67304, 45950, 60904, 45690, 56112,
+    1354, 19439, 60535, 31659, 31688, 4347, 8760, 4247, 60953, 4307,
+    8718, 12365, 8146, 4149, 36649, 10179, 51523, 38749, 1744, 43623,
+    19340, 51968, 51964, 60769, 17770, 38970, 23896, 60956, 38716, 51788,
+    17852, 64051, 4131, 56843, 31582, 39037, 23981, 31255, 39041, 24043,
+    11399, 31825, 45815, 12378, 52021, 46146, 18067, 31794, 19186, 24018,
+    46026, 17729, 14188, 16451, 38806, 17754, 35011, 41386, 12531, 14599,
+    7500, 46052, 13905, 42084, 17811, 63826, 52016, 67307, 31778, 46368,
+    45908, 66019, 23972, 65653, 45812, 51652, 27517, 11046, 38828, 56684,
+    52074, 38808, 60791, 31750, 7932, 12560, 11019, 39636, 67338, 4397,
+    11057, 38843, 61055, 45814, 4790, 16710, 63515, 17595, 56769, 51955,
+    56900, 64012, 31809, 17966, 31686, 68408, 31180, 64056, 2081, 4196,
+    56972, 39183, 24073, 33262, 7397, 52115, 38785, 37544, 51760, 27526,
+    56823, 60775, 31497, 38910, 67292, 4425, 22164, 38948, 21218, 56975,
+    56729, 7527, 52040, 17877, 1174, 5024, 24124, 12634, 61010, 39044,
+    57094, 52111, 12013, 61022, 17892, 52289, 46044, 46551, 31900, 46069,
+    2185, 63708, 37711, 31874, 24194, 66958, 17975, 45935, 46087, 46118,
+    17011, 17701, 52108, 56534, 40142, 24139, 39093, 12657, 30754, 24200,
+    56687, 39107, 67963, 27048, 60649, 7583, 63849, 57342, 17010, 7896,
+    45810, 52076, 63995, 52054, 24338, 31987, 24293, 17915, 18099, 18909,
+    2076, 52272, 2162, 64087, 39148, 53134, 52353, 31787, 52185, 55820,
+    42859, 22694, 39400, 45933, 52146, 46009, 52093, 4584, 57184, 3,
+    45900, 4830, 9869, 39218, 31579, 23968, 45914, 39247, 56997, 2929,
+    20178, 18212, 39203, 64101, 56957, 50705, 18323, 53988, 24025, 32112,
+    24405, 8333, 39430, 12137, 18050, 57179, 46222, 52131, 7790, 52376,
+    18217, 39240, 29504, 18371, 20199, 39276, 39425, 12716, 18787, 1871,
+    46381, 7730, 39352, 46294, 64015, 7836, 60915, 4349, 60880, 24058,
+    24345, 39402, 31912, 39469, 17998, 23031, 2375, 60874, 32025, 46040,
+    12668, 38624, 52414, 61003, 18188, 48846, 23964, 42727, 39117, 27735,
+    52164, 24179, 46232, 32037, 8970, 24429, 39556, 39522, 39573, 3278,
+    34818, 39592, 64057, 18287, 52430, 24503, 27324, 37068, 51959, 39546,
+    45990, 56946, 39444, 46419, 52369, 32187, 39639, 31963, 821, 67257,
+    18004, 54516, 24343, 50385, 32210, 61181, 46417, 46188, 10140, 32116,
+    43038, 67268, 32107, 61013, 25798, 46324, 46334, 7755, 67294, 32000,
+    61176, 46446, 10777, 25747, 64135, 6910, 24450, 11008, 60911, 32301,
+    64187, 16040, 52066, 46406, 39690, 52423, 46443, 24684, 32426, 5632,
+    24485, 31020, 32136, 46380, 39756, 63895, 46552, 46311, 13296, 57135,
+    32292, 7815, 24465, 49240, 32383, 24433, 32364, 39663, 61120, 4424,
+    24423, 32295, 45616, 24602, 56875, 18199, 3010, 51508, 56979, 4536,
+    21864, 57166, 52504, 32436, 18137, 19094, 39829, 16511, 28343, 56705,
+    32503, 57306, 7874, 57170, 32552, 34921, 12839, 60803, 7679, 52327,
+    15800, 24670, 52465, 39650, 32729, 39729, 61021, 17335, 52230, 32661,
+    61214, 52233, 57239, 4685, 39496, 50, 64197, 24644, 29290, 32531,
+    46537, 32714, 49023, 12712, 52495, 24553, 39826, 64158, 12464, 57224,
+    53425, 67345, 12806, 32835, 4385, 46708, 39563, 32624, 24655, 61224,
+    2260, 65981, 24430, 32596, 52559, 46280, 30384, 39991, 66058, 46640,
+    61129, 2191, 46600, 61112, 57101, 18174, 46567, 537, 57066, 12690,
+    52531, 32754, 46610, 216, 24601, 46483, 11842, 46779, 2393, 39917,
+    24677, 15697, 57441, 1860, 12751, 61192, 12883, 52441, 32457, 57197,
+    24803, 19345, 32550, 22126, 38753, 18310, 39944, 18293, 32609, 46665,
+    60621, 13001, 46733, 2303, 61192, 24765, 52165, 8015, 61234, 24820,
+    51833, 32798, 61270, 51907, 60683, 32806, 48075, 24376, 6598, 15259,
+    4733, 32601, 2365, 46755, 10350, 64138, 876, 52604, 24854, 57297,
+    46951, 61337, 24973, 49182, 39142, 66052, 61274, 39892, 3560, 15011,
+    39950, 12922, 61327, 4538, 47450, 7816, 57177, 24843, 46749, 39987,
+    26412, 4678, 24945, 32750, 57435, 32944, 40059, 18463, 52635, 52587,
+    4753, 46584, 12951, 57382, 24865, 61226, 7932, 39748, 24963, 40089,
+    18580, 52695, 8386, 46570, 2461, 24992, 46631, 25184, 46867, 18517,
+    52534, 32784, 52749, 9952, 64239, 7981, 52620, 12997, 46787, 40084,
+    8528, 8032, 40696, 32853, 12765, 31214, 24588, 61229, 15017, 27858,
+    32985, 36036, 8802, 57355, 8206, 40049, 32831, 53954, 13031, 3392,
+    13132, 64076, 52595, 29399, 52635, 57073, 40080, 52723, 17511, 13236,
+    57393, 64141, 46897, 11738, 44745, 287, 64232, 8134, 46958, 8170,
+    47110, 33063, 65841, 6623, 61368, 47143, 38292, 57188, 25077, 47101,
+    37988, 57260, 61265, 61334, 18477, 16220, 15689, 32948, 4772, 57469,
+    4865, 61382, 19781, 40034, 32936, 46604, 4200, 39784, 40205, 33008,
+    40164, 25280, 63748, 18642, 57515, 25131, 46815, 7876, 61367, 25334,
+    34637, 18695, 18657, 18644, 30231, 18806, 46982, 47029, 46971, 40211,
+    18869, 47197, 18776, 17631, 4481, 16964, 32984, 57530, 25223, 52750,
+    52860, 40227, 8361, 66115, 40193, 20630, 2277, 52678, 3331, 21384,
+    20477, 2494, 10247, 8057, 52836, 32960, 2103, 25172, 63924, 33189,
+    65935, 684, 66115, 25053, 64159, 33084, 68387, 64053, 46428, 25380,
+    33040, 51950, 25225, 14618, 33238, 57465, 2524, 20602, 25440, 37536,
+    37439, 65767, 13105, 9047, 47170, 28157, 57414, 33010, 64120, 20847,
+    52775, 57526, 41989, 25304, 39006, 8281, 6974, 40325, 35696, 18757,
+    40379, 2674, 52815, 47180, 33250, 25646, 18859, 8437, 310, 57520,
+    39405, 33269, 40171, 46972, 25164, 57603, 13267, 64282, 539, 66140,
+    18730, 33197, 40058, 25440, 25470, 52755, 18781, 18701, 47238, 12443,
+    33305, 47074, 40226, 47288, 64262, 13128, 66094, 13319, 60700, 40190,
+    43574, 33228, 23492, 18846, 63694, 57171, 40309, 6134, 47034, 25148,
+    57159, 33577, 18539, 67863, 8241, 52913, 61347, 57768, 33004, 63427,
+    19043, 61447, 47186, 89, 47321, 32774, 25367, 57285, 45223, 52875,
+    64195, 18972, 64272, 25210, 47284, 64320, 64251, 13382, 26301, 25461,
+    33144, 25405, 57568, 943, 64328, 33312, 47358, 53053, 7166, 1472,
+    47031, 57669, 25554, 57391, 57682, 52983, 52754, 8502, 47378, 47417,
+    5922, 16732, 8427, 47517, 18961, 39456, 8334, 6627, 19096, 33298,
+    57595, 40448, 47331, 25673, 19178, 40432, 64245, 33451, 510, 13300,
+    778, 13343, 47464, 40477, 61288, 19339, 18977, 4845, 57649, 57704,
+    19236, 2713, 40313, 47374, 25543, 57631, 2854, 17049, 1, 40362,
+    32138, 64074, 20121, 61463, 40509, 40496, 22986, 57638, 33476, 9496,
+    27255, 52713, 52871, 25677, 61414, 13366, 47501, 33532, 32773, 16715,
+    61121, 13288, 47589, 47335, 52845, 24079, 34974, 12015, 57479, 47339,
+    36698, 40473, 36785, 57590, 40319, 40633, 19260, 57785, 19295, 19391,
+    4931, 40506, 7148, 57745, 1104, 64115, 25471, 47575, 40580, 11486,
+    33510, 35099, 40618, 22051, 56633, 46880, 57941, 47542, 25551, 8436,
+    30273, 753, 64274, 13120, 57625, 25643, 13829, 33547, 20254, 25791,
+    47456, 25769, 40609, 57809, 5978, 47574, 53014, 40242, 8458, 52964,
+    4798, 57844, 13507, 25950, 8603, 9859, 25931, 40612, 19305, 25786,
+    40696, 52978, 5031, 33494, 47608, 53084, 56844, 8550, 40811, 33428,
+    53122, 13710, 44164, 13584, 13781, 33665, 57756, 47682, 61133, 25997,
+    48936, 33487, 52760, 40736, 8338, 53114, 52869, 66034, 5089, 40632,
+    13446, 21401, 19311, 47630, 9907, 27297, 26068, 66109, 26140, 1038,
+    23474, 34664, 33547, 22145, 61279, 19167, 33758, 75, 40510, 40709,
+    9483, 5018, 47546, 8650, 67506, 5150, 51337, 40799, 61425, 33813,
+    61130, 47505, 57741, 53074, 19387, 57789, 19145, 8755, 40878, 58501,
+    47687, 64175, 5191, 61376, 25866, 61462, 26154, 64297, 2701, 29620,
+    47835, 47423, 47689, 26044, 52968, 47270, 33698, 26245, 53152, 8737,
+    61465, 26237, 33761, 26058, 65991, 1164, 61529, 8118, 58005, 53218,
+    5114, 13592, 57715, 33895, 47704, 47717, 13660, 53299, 26308, 53188,
+    26243, 61310, 13798, 26798, 5236, 43434, 3567, 8860, 31379, 53130,
+    19053, 38617, 47721, 47639, 53302, 47699, 33776, 13681, 61404, 13861,
+    61513, 27, 61498, 2349, 38486, 40901, 44118, 26541, 57420, 8698,
+    61481, 12532, 61654, 26044, 40907, 26119, 53060, 60644, 1074, 32340,
+    26058, 12126, 40978, 47822, 13915, 53345, 19522, 42661, 40765, 61497,
+    19474, 64306, 36957, 33160, 33764, 28379, 24725, 47553, 61608, 21016,
+    65947, 52868, 61484, 1076, 57815, 33735, 57860, 33918, 67169, 3164,
+    27089, 40837, 53386, 61537, 47757, 33867, 40962, 64354, 64414, 64101,
+    19538, 57998, 26218, 61547, 33810, 61585, 8864, 64362, 13495, 16316,
+    53356, 53111, 33839, 47675, 40740, 52949, 53328, 13831, 34087, 53390,
+    53162, 33784, 22805, 22363, 64042, 26311, 61665, 19463, 46548, 53522,
+    57565, 41063, 61469, 53324, 40951, 47826, 40869, 19611, 13164, 47757,
+    26321, 2733, 8754, 57964, 19555, 25917, 13901, 1582, 26499, 53503,
+    47992, 47964, 32286, 64277, 19773, 40623, 47915, 41034, 61557, 17700,
+    47997, 8627, 53421, 26465, 68326, 19874, 61742, 26452, 53402, 28774,
+    67224, 34146, 42493, 48062, 64190, 15623, 48031, 64225, 7227, 14206,
+    41004, 64296, 13975, 60592, 6593, 9554, 57900, 57855, 13998, 66089,
+    34001, 64458, 26512, 26637, 64469, 62963, 61551, 41075, 17679, 34009,
+    61928, 41111, 48002, 40998, 64484, 53577, 57823, 2681, 67892, 26394,
+    26598, 19278, 65909, 48174, 26631, 34101, 41159, 64414, 26607, 48257,
+    47809, 12158, 53185, 28861, 34184, 64403, 47974, 8211, 53552, 56736,
+    45422, 57990, 41105, 5222, 57845, 34168, 23921, 41104, 57939, 48109,
+    32145, 14006, 61627, 48100, 61636, 26720, 570, 19689, 39471, 53551,
+    53585, 41133, 31410, 33888, 24392, 58168, 64437, 58075, 34174, 17401,
+    33903, 21348, 53362, 53631, 8974, 67182, 41267, 34411, 26768, 48206,
+    53497, 18684, 34345, 38066, 58030, 13681, 66187, 12267, 26736, 31906,
+    22900, 16709, 4509, 34252, 67319, 41109, 41008, 45380, 61702, 14180,
+    34075, 21812, 57747, 61784, 48208, 26671, 1593, 14177, 57966, 58114,
+    9034, 35867, 58167, 41357, 41236, 52857, 34133, 58171, 26723, 4210,
+    57887, 53708, 9005, 41264, 34307, 58206, 41271, 14101, 48240, 31969,
+    34455, 53752, 41207, 34401, 61611, 14196, 64422, 48075, 48643, 43829,
+    10710, 9013, 57775, 61645, 48254, 57961, 5249, 41438, 58067, 26568,
+    41258, 53621, 19767, 48362, 14115, 33409, 26891, 64400, 14189, 64402,
+    14020, 53612, 64443, 53606, 26772, 27583, 26892, 61741, 48032, 34233,
+    34538, 19550, 48339, 53768, 58244, 0, 53746, 10326, 30994, 48276,
+    61667, 41385, 44175, 26834, 66069, 26973, 58168, 53761, 46499, 22350,
+    61475, 61703, 41649, 58232, 14151, 58176, 41499, 41591, 38899, 24766,
+    26982, 61942, 5195, 58141, 48345, 58198, 9204, 41689, 58240, 53876,
+    58359, 27067, 58396, 26831, 41352, 53844, 58265, 23747, 41859, 5435,
+    13330, 19706, 58429, 1301, 41754, 5213, 34579, 27035, 19905, 48469,
+    27045, 19937, 19576, 57979, 53759, 48459, 20036, 53733, 48321, 58316,
+    5607, 39655, 19880, 61817, 27202, 53789, 30922, 19592, 34607, 41553,
+    58372, 48574, 38371, 27235, 31743, 7558, 24054, 27179, 30221, 14287,
+    58413, 14355, 61886, 39596, 48727, 20012, 48432, 34620, 34043, 41811,
+    37173, 34650, 41543, 27051, 9088, 36312, 13399, 64529, 5442, 1292,
+    53838, 35619, 27232, 1676, 48303, 61655, 58336, 61753, 48484, 66110,
+    34568, 53301, 58202, 14356, 54888, 19875, 64517, 48150, 67824, 19983,
+    61774, 53811, 53802, 20097, 34653, 53906, 60460, 20075, 53830, 34601,
+    19460, 58279, 26942, 61863, 33438, 62066, 27312, 34611, 9133, 58569,
+    13127, 36149, 48530, 61623, 20278, 58632, 27227, 52576, 37264, 41702,
+    53699, 41545, 34465, 34233, 48130, 41505, 58704, 8990, 11261, 53857,
+    64203, 24576, 48817, 19806, 67051, 48442, 20202, 48542, 39536, 20565,
+    41745, 58042, 27080, 53713, 41663, 35636, 53935, 36000, 34837, 49733,
+    34378, 68007, 48484, 50392, 34802, 54671, 61809, 48587, 34561, 48672,
+    66179, 27211, 41760, 18884, 53917, 6010, 33198, 48627, 64491, 34740,
+    61965, 20134, 64845, 27390, 64592, 14906, 61982, 64474, 58101, 48606,
+    58285, 28182, 2027, 34865, 58299, 40027, 61876, 66027, 41810, 19852,
+    5296, 66252, 41759, 61910, 48631, 53987, 27460, 34220, 41559, 29801,
+    58550, 54107, 48587, 48650, 62070, 58463, 67216, 7419, 61904, 27143,
+    32650, 48687, 41898, 27544, 58512, 5095, 64594, 24950, 38166, 28796,
+    48576, 34813, 2528, 36435, 27600, 62055, 20352, 33707, 52812, 54013,
+    41852, 42542, 48799, 12904, 20094, 67403, 61642, 64320, 41875, 5655,
+    53826, 41897, 64411, 5540, 50894, 48775, 2536, 47801, 67335, 20367,
+    61788, 20286, 36741, 6164, 64588, 14512, 58193, 41950, 1090, 61675,
+    41900, 58419, 41825, 54072, 58378, 61821, 14434, 62191, 5645, 31698,
+    5742, 26443, 42024, 29059, 41979, 64590, 58615, 64630, 64556, 65893,
+    61884, 64260, 62031, 44496, 1821, 27358, 62098, 34776, 62238, 54165,
+    67943, 14462, 47910, 27403, 54139, 16591, 61956, 20458, 42224, 41952,
+    67291, 62130, 42144, 41692, 58411, 48299, 42146, 43763, 27487, 66234,
+    6316, 64741, 34580, 53850, 14261, 42147, 27681, 17924, 33313, 42258,
+    25355, 53839, 42214, 47788, 64617, 54141, 16190, 20386, 66271, 62124,
+    67246, 31268, 37025, 54249, 37008, 61936, 56555, 62236, 62125, 58556,
+    12832, 42229, 54302, 66221, 48707, 66297, 45954, 48736, 58508, 67118,
+    23489, 54233, 42301, 58591, 41651, 17728, 27643, 58426, 7387, 54140,
+    66277, 58624, 61875, 4249, 62173, 54238, 53882, 64692, 58846, 27695,
+    34824, 42223, 43513, 9376, 64700, 9171, 66072, 62182, 58588, 23500,
+    66251, 62152, 64665, 64574, 9252, 64732, 67210, 48608, 58383, 66061,
+    48852, 62242, 3420, 64662, 48757, 48851, 48837, 25196, 42343, 58784,
+    1249, 62171, 5026, 48951, 35064, 30603, 28466, 58795, 58885, 27789,
+    64597, 61733, 27790, 34962, 64610, 54304, 64641, 35087, 54204, 34879,
+    62115, 42486, 7145, 27707, 29962, 21833, 20480, 22943, 11989, 54153,
+    42393, 33848, 50493, 66074, 48474, 64700, 67203, 2262, 9923, 67878,
+    34874, 56595, 53891, 48938, 54355, 48753, 58803, 9238, 49038, 20633,
+    3270, 20561, 49099, 49101, 58838, 58835, 21981, 42236, 48058, 27585,
+    62270, 35209, 62196, 48982, 42023, 42269, 27786, 54023, 27600, 13568,
+    27678, 42462, 29702, 64552, 20530, 66276, 48690, 43999, 11745, 58748,
+    25136, 19295, 54252, 58841, 48973, 54228, 58874, 58627, 49207, 194,
+    47472, 9442, 64810, 27763, 68355, 54269, 64711, 9205, 62319, 48865,
+    54492, 27949, 28130, 35111, 8096, 35219, 59006, 58732, 58995, 58625,
+    20369, 58890, 34702, 53973, 20734, 66156, 5545, 28600, 49147, 7036,
+    28090, 54242, 14555, 49263, 34982, 13067, 54189, 21739, 62363, 4874,
+    66207, 35202, 66212, 14542, 64487, 42188, 54366, 42284, 64678, 42478,
+    54331, 14446, 42, 54475, 35256, 20708, 49159, 31886, 43705, 64779,
+    9396, 58909, 42322, 62276, 42482, 62215, 20562, 17678, 5786, 64774,
+    21315, 54432, 28071, 49187, 513, 62516, 49085, 14795, 12667, 14686,
+    49217, 58927, 15868, 35215, 59084, 14646, 62404, 26457, 62344, 35018,
+    64654, 20730, 15891, 48893, 49290, 66269, 28098, 8542, 27606, 35119,
+    21023, 37254, 35080, 26773, 42384, 24890, 42495, 44350, 2912, 64975,
+    35289, 11381, 62380, 22299, 54453, 52445
+};
+
 /*
 ** Used for a non-efficient method of permuting over all
 ** C(7,5) combinations of choosing five cards from seven.
@@ -4,5 +4,7 @@ PHP_ARG_ENABLE(phpoker, whether to enable phpoker support,
 [  --enable-phpoker        Enable phpoker support])
 
 if test "$PHP_PHPOKER" != "no"; then
+  PHP_ADD_LIBRARY(pthread, 1, PHPOKER_SHARED_LIBADD)
+  PHP_SUBST(PHPOKER_SHARED_LIBADD)
   PHP_NEW_EXTENSION(phpoker, phpoker.c, $ext_shared)
 fi
\ No newline at end of file
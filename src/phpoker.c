@@ -2,27 +2,110 @@
 #include "config.h"
 #endif
 
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define PHP_POKER_SIMD 1
+#include <immintrin.h>
+#endif
+
 #include "php.h"
 #include "php_ini.h"
 #include "ext/standard/info.h"
+#if PHP_VERSION_ID >= 80200
+#include "ext/random/php_random.h"
+#else
+#include "ext/standard/php_random.h"
+#endif
 #include "phpoker.h"
 #include "arrays.h"
+#include "preflop_chart.h"
 #include "zend_exceptions.h"  /* Added for exception support */
+#include "zend_interfaces.h"
 
 ZEND_BEGIN_ARG_INFO(arginfo_poker_evaluate_hand, 0)
 	ZEND_ARG_INFO(0, hand)
 ZEND_END_ARG_INFO()
 
+ZEND_DECLARE_MODULE_GLOBALS(phpoker)
+
+ZEND_BEGIN_ARG_INFO(arginfo_poker_evaluate_hands, 0)
+	ZEND_ARG_INFO(0, hands)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO(arginfo_poker_evaluate_omaha, 0)
+	ZEND_ARG_INFO(0, hole)
+	ZEND_ARG_INFO(0, board)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_poker_evaluate_low, 0, 0, 1)
+	ZEND_ARG_INFO(0, hand)
+	ZEND_ARG_INFO(0, type)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO(arginfo_poker_cards, 0)
+	ZEND_ARG_INFO(0, cards)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO(arginfo_poker_generate_lookup_table, 0)
+	ZEND_ARG_INFO(0, path)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO(arginfo_poker_generate_preflop_table, 0)
+	ZEND_ARG_INFO(0, path)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_poker_preflop_equity, 0, 0, 1)
+	ZEND_ARG_INFO(0, hand)
+	ZEND_ARG_INFO(0, opponents)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_poker_generate_preflop_chart, 0, 0, 1)
+	ZEND_ARG_INFO(0, path)
+	ZEND_ARG_INFO(0, iterations)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_poker_calculate_runouts, 0, 0, 2)
+	ZEND_ARG_INFO(0, hole_cards)
+	ZEND_ARG_INFO(0, board_cards)
+	ZEND_ARG_INFO(0, dead_cards)
+	ZEND_ARG_INFO(0, options)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO(arginfo_poker_cache, 0)
+ZEND_END_ARG_INFO()
+
 ZEND_BEGIN_ARG_INFO(arginfo_poker_calculate_equity, 0)
 	ZEND_ARG_INFO(0, hole_cards)
 	ZEND_ARG_INFO(0, board_cards)
 	ZEND_ARG_INFO(0, iterations)
 	ZEND_ARG_INFO(0, dead_cards)
+	ZEND_ARG_INFO(0, options)
 ZEND_END_ARG_INFO()
 
 const zend_function_entry phpoker_functions[] = {
 	PHP_FE(poker_evaluate_hand, arginfo_poker_evaluate_hand)
+	PHP_FE(poker_evaluate_hands, arginfo_poker_evaluate_hands)
+	PHP_FE(poker_evaluate_omaha, arginfo_poker_evaluate_omaha)
+	PHP_FE(poker_evaluate_short_deck, arginfo_poker_evaluate_hand)
+	PHP_FE(poker_evaluate_low, arginfo_poker_evaluate_low)
+	PHP_FE(poker_cards_to_ids, arginfo_poker_cards)
+	PHP_FE(poker_cards_to_mask, arginfo_poker_cards)
+	PHP_FE(poker_cards_to_string, arginfo_poker_cards)
 	PHP_FE(poker_calculate_equity, arginfo_poker_calculate_equity)
+	PHP_FE(poker_calculate_runouts, arginfo_poker_calculate_runouts)
+	PHP_FE(poker_generate_lookup_table, arginfo_poker_generate_lookup_table)
+	PHP_FE(poker_generate_preflop_table, arginfo_poker_generate_preflop_table)
+	PHP_FE(poker_preflop_equity, arginfo_poker_preflop_equity)
+	PHP_FE(poker_generate_preflop_chart, arginfo_poker_generate_preflop_chart)
+	PHP_FE(poker_cache_stats, arginfo_poker_cache)
+	PHP_FE(poker_cache_clear, arginfo_poker_cache)
 	PHP_FE_END
 };
 
@@ -36,7 +119,11 @@ zend_module_entry phpoker_module_entry = {
 	NULL,
 	PHP_MINFO(phpoker),
 	PHP_PHPOKER_VERSION,
-	STANDARD_MODULE_PROPERTIES
+	PHP_MODULE_GLOBALS(phpoker),
+	PHP_GINIT(phpoker),
+	NULL,
+	NULL,
+	STANDARD_MODULE_PROPERTIES_EX
 };
 
 #ifdef COMPILE_DL_PHPOKER
@@ -46,6 +133,20 @@ ZEND_TSRMLS_CACHE_DEFINE()
 ZEND_GET_MODULE(phpoker)
 #endif
 
+PHP_INI_BEGIN()
+	STD_PHP_INI_ENTRY("phpoker.evaluator", "cactus", PHP_INI_SYSTEM, OnUpdateString, evaluator, zend_phpoker_globals, phpoker_globals)
+	STD_PHP_INI_ENTRY("phpoker.lookup_table", "", PHP_INI_SYSTEM, OnUpdateString, lookup_table, zend_phpoker_globals, phpoker_globals)
+	STD_PHP_INI_ENTRY("phpoker.exact_threshold", "50000", PHP_INI_ALL, OnUpdateLong, exact_threshold, zend_phpoker_globals, phpoker_globals)
+	STD_PHP_INI_ENTRY("phpoker.preflop_table", "", PHP_INI_SYSTEM, OnUpdateString, preflop_table, zend_phpoker_globals, phpoker_globals)
+	STD_PHP_INI_ENTRY("phpoker.threads", "1", PHP_INI_ALL, OnUpdateLong, threads, zend_phpoker_globals, phpoker_globals)
+	STD_PHP_INI_ENTRY("phpoker.cache_size", "0", PHP_INI_SYSTEM, OnUpdateLong, cache_size, zend_phpoker_globals, phpoker_globals)
+	STD_PHP_INI_ENTRY("phpoker.shared_cache_size", "0", PHP_INI_SYSTEM, OnUpdateLong, shared_cache_size, zend_phpoker_globals, phpoker_globals)
+	STD_PHP_INI_ENTRY("phpoker.shared_cache_ttl", "3600", PHP_INI_SYSTEM, OnUpdateLong, shared_cache_ttl, zend_phpoker_globals, phpoker_globals)
+PHP_INI_END()
+
+/* All 52 cards as a card mask (bit n is card id n, see php_poker_card_from_id) */
+#define PHP_POKER_DECK_MASK ((1ULL << 52) - 1)
+
 /* Card representation:
  *   +--------+--------+--------+--------+
  *   |xxxbbbbb|bbbbbbbb|cdhsrrrr|xxpppppp|
@@ -63,6 +164,166 @@ ZEND_GET_MODULE(phpoker)
 #define SPADE   0x1000
 #define RANK(x) ((x >> 8) & 0xF)
 
+/* poker_calculate_equity modes */
+#define PHP_POKER_MODE_AUTO          0
+#define PHP_POKER_MODE_EXACT         1
+#define PHP_POKER_MODE_MONTE_CARLO   2
+#define PHP_POKER_MODE_TABLE         3  /* Answered from the preflop table */
+
+/* poker_calculate_equity games, and the hole cards each player holds in them */
+#define PHP_POKER_GAME_HOLDEM        0
+#define PHP_POKER_GAME_OMAHA         1  /* Exactly two hole cards and three board cards */
+#define PHP_POKER_GAME_OMAHA5        2  /* Five-card Omaha, same rule */
+#define PHP_POKER_GAME_SHORTDECK     3  /* Six to ace only, flushes beat full houses */
+
+static const int php_poker_game_hole_cards[] = {2, 4, 5, 2};
+
+/* The 36 cards of a short deck, six through ace of each suit */
+#define PHP_POKER_SHORT_DECK_MASK    (0x1ff0ULL * (1 | 1ULL << 13 | 1ULL << 26 | 1ULL << 39))
+
+/* Rank bits of A-6-7-8-9, the lowest short-deck straight */
+#define PHP_POKER_SHORT_WHEEL        0x10f0
+
+/* Direct 6/7-card evaluator tables, built once in MINIT and read-only afterwards:
+ *   php_poker_flush_lookup - best flush/straight flush for any 13-bit rank mask
+ *   php_poker_rank_lookup  - hand value for a summed rank key (see rank_keys
+ *                            and rank_offsets6/rank_offsets7 in arrays.h)
+ */
+#define PHP_POKER_ROW_BITS           12
+#define PHP_POKER_ROW_MASK           ((1 << PHP_POKER_ROW_BITS) - 1)
+#define PHP_POKER_RANK_LOOKUP_SIZE   69445
+#define PHP_POKER_SUIT_COUNTER_INIT  0x3333
+
+/* One spare entry each: the batch kernels read 16-bit entries 32 bits at a time */
+static unsigned short php_poker_flush_lookup[8192 + 1];
+static unsigned short php_poker_rank_lookup[PHP_POKER_RANK_LOOKUP_SIZE + 1];
+
+/* The same two tables with short-deck values (see php_poker_short_value) */
+static unsigned short php_poker_short_flush_lookup[8192];
+static unsigned short php_poker_short_rank_lookup[PHP_POKER_RANK_LOOKUP_SIZE];
+
+/* Ace-to-five eight-or-better lows: value of the best low for any set of
+ * low ranks (see php_poker_low_bits), 1 for 5-4-3-2-A up to 56 for
+ * 8-7-6-5-4, or 0 when fewer than five distinct ranks qualify
+ */
+static unsigned char php_poker_low_lookup[256];
+
+/* Hold'em values of A-6-4-3-2, the best ace-high hand once A-2-3-4-5 is no
+ * straight, offsuit and as a flush (see php_poker_eval_deuce_seven)
+ */
+#define PHP_POKER_ACE_SIX_HIGH       6678
+#define PHP_POKER_ACE_SIX_FLUSH      815
+
+/* Rank bits of A-5-4-3-2 */
+#define PHP_POKER_WHEEL              0x100f
+
+/* Hi-lo pots are counted in units that split evenly between up to ten
+ * winners of each half
+ */
+#define PHP_POKER_POT_UNITS          5040
+
+/* Batch evaluation kernel picked for this CPU in MINIT, and 32-bit copies of
+ * the Cactus Kev tables for the vector kernels (sized for any 13-bit index)
+ */
+static php_poker_eval_batch_func php_poker_eval_batch = php_poker_eval_batch_scalar;
+static const char *php_poker_eval_batch_name = "scalar";
+
+#ifdef PHP_POKER_SIMD
+static unsigned php_poker_simd_flushes[8192];
+static unsigned php_poker_simd_unique5[8192];
+static unsigned php_poker_simd_hash_adjust[512];
+static unsigned php_poker_simd_hash_values[8192];
+#endif
+
+/* Two Plus Two state table (optional backend, see phpoker.evaluator). Mapped
+ * read-only in MINIT; NULL when the Cactus Kev evaluator is in use.
+ */
+#define PHP_POKER_TPT_MAGIC          "PHPOKTPT"
+#define PHP_POKER_TPT_VERSION        1
+#define PHP_POKER_TPT_STATES         612977
+#define PHP_POKER_TPT_START          53
+#define PHP_POKER_TPT_SIZE           (53 * (PHP_POKER_TPT_STATES + 1))
+#define PHP_POKER_TPT_FILE_SIZE      (sizeof(php_poker_tpt_header) + sizeof(int) * PHP_POKER_TPT_SIZE)
+#define PHP_POKER_TPT_HASH_BITS      21
+#define PHP_POKER_TPT_HASH_SIZE      (1 << PHP_POKER_TPT_HASH_BITS)
+
+static const int *php_poker_tpt = NULL;
+static void *php_poker_tpt_base = NULL;
+
+/* Hand ranges: suitedness flags of a starting hand class, and how many
+ * conflicting deals in a row are redrawn before giving up
+ */
+#define PHP_POKER_SUITED             1
+#define PHP_POKER_OFFSUIT            2
+#define PHP_POKER_MAX_REJECTS        100000
+
+/* Card indices (higher first) and card mask of every combo index, built in MINIT */
+static unsigned char php_poker_combo_cards[PHP_POKER_COMBOS][2];
+static uint64_t php_poker_combo_masks[PHP_POKER_COMBOS];
+
+/* PHPoker\Range class */
+static zend_class_entry *php_poker_range_ce;
+static zend_object_handlers php_poker_range_handlers;
+
+/* PHPoker\EquityCalculator class */
+static zend_class_entry *php_poker_calculator_ce;
+static zend_object_handlers php_poker_calculator_handlers;
+
+/* Exact heads-up preflop results, one entry per suit-isomorphic matchup
+ * (see php_poker_preflop_key). Mapped read-only in MINIT when
+ * phpoker.preflop_table is set; NULL otherwise.
+ */
+#define PHP_POKER_PREFLOP_MAGIC      "PHPOKPFT"
+#define PHP_POKER_PREFLOP_VERSION    1
+#define PHP_POKER_PREFLOP_ENTRIES    47008
+#define PHP_POKER_PREFLOP_BOARDS     1712304
+#define PHP_POKER_PREFLOP_FILE_SIZE  (sizeof(php_poker_preflop_header) + sizeof(php_poker_preflop_entry) * PHP_POKER_PREFLOP_ENTRIES)
+
+static const php_poker_preflop_entry *php_poker_preflop = NULL;
+static void *php_poker_preflop_base = NULL;
+
+/* Monte Carlo worker pool, shared by all request threads of the process and
+ * started on first use (see php_poker_simulate). Iterations are handed out in
+ * chunks of PHP_POKER_CHUNK_SIZE, each with its own random stream.
+ */
+#define PHP_POKER_CHUNK_SIZE         4096
+
+static php_poker_pool php_poker_pool_state = {
+	PTHREAD_MUTEX_INITIALIZER,
+	PTHREAD_COND_INITIALIZER,
+	PTHREAD_COND_INITIALIZER
+};
+
+/* All 24 renamings of the four suit indices */
+static const unsigned char php_poker_suit_perms[24][4] = {
+	{0, 1, 2, 3}, {0, 1, 3, 2}, {0, 2, 1, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {0, 3, 2, 1},
+	{1, 0, 2, 3}, {1, 0, 3, 2}, {1, 2, 0, 3}, {1, 2, 3, 0}, {1, 3, 0, 2}, {1, 3, 2, 0},
+	{2, 0, 1, 3}, {2, 0, 3, 1}, {2, 1, 0, 3}, {2, 1, 3, 0}, {2, 3, 0, 1}, {2, 3, 1, 0},
+	{3, 0, 1, 2}, {3, 0, 2, 1}, {3, 1, 0, 2}, {3, 1, 2, 0}, {3, 2, 0, 1}, {3, 2, 1, 0}
+};
+
+/* Equity results of recent scenarios, shared by all request threads of the
+ * process. Allocated in MINIT when phpoker.cache_size is set, up to
+ * PHP_POKER_CACHE_MAX entries.
+ */
+#define PHP_POKER_CACHE_MAX          1000000
+
+static php_poker_cache php_poker_cache_state = {
+	PTHREAD_MUTEX_INITIALIZER
+};
+
+/* Result cache in an anonymous shared mapping made in MINIT, so the worker
+ * processes forked afterwards all share it (see php_poker_shm_init). NULL
+ * unless phpoker.shared_cache_size is set.
+ */
+static php_poker_shm *php_poker_shm_cache = NULL;
+static size_t php_poker_shm_size = 0;
+
+/* Suit counter increments indexed by the one-hot suit nibble of a card */
+static const unsigned php_poker_suit_adds[16] = {
+	0, 0x0001, 0x0010, 0, 0x0100, 0, 0, 0, 0x1000, 0, 0, 0, 0, 0, 0, 0
+};
+
 /* Each of the thirteen card ranks has its own prime number
  * Note: primes array is already defined in arrays.h, so we don't redefine it here
  */
@@ -121,10 +382,31 @@ static int php_poker_char_to_suit(char c)
  */
 static int php_poker_parse_hand(const char *hand_str, int *cards, int max_cards)
 {
-	int card_index, str_index;
+	return php_poker_parse_cards(hand_str, cards, max_cards, NULL);
+}
+
+/**
+ * Parse a hand string that may hold unknown cards ("??")
+ *
+ * Known cards are stored in order; unknown ones are only counted, and
+ * still count towards max_cards.
+ *
+ * @param hand_str String representation of a poker hand
+ * @param cards Array to store the parsed card values
+ * @param max_cards Maximum number of cards to parse
+ * @param unknown Receives the number of unknown cards, or NULL to reject them
+ * @return int Number of cards parsed, known and unknown, or -1 on error
+ */
+static int php_poker_parse_cards(const char *hand_str, int *cards, int max_cards, int *unknown)
+{
+	int str_index;
 	int count = 0;
 	size_t str_length = strlen(hand_str);
 
+	if (unknown) {
+		*unknown = 0;
+	}
+
 	for (str_index = 0; str_index < str_length && count < max_cards; str_index++) {
 		char rank_char = hand_str[str_index];
 
@@ -140,6 +422,14 @@ static int php_poker_parse_hand(const char *hand_str, int *cards, int max_cards)
 
 		char suit_char = hand_str[str_index + 1];
 
+		/* A card dealt at random */
+		if (unknown && rank_char == '?' && suit_char == '?') {
+			(*unknown)++;
+			count++;
+			str_index++;
+			continue;
+		}
+
 		int rank = php_poker_char_to_rank(rank_char);
 		int suit = php_poker_char_to_suit(suit_char);
 
@@ -149,7 +439,8 @@ static int php_poker_parse_hand(const char *hand_str, int *cards, int max_cards)
 		}
 
 		/* Create card value in the format expected by the evaluator */
-		cards[count++] = (1 << (16 + rank)) | (rank << 8) | suit | primes[rank];
+		cards[count - (unknown ? *unknown : 0)] = (1 << (16 + rank)) | (rank << 8) | suit | primes[rank];
+		count++;
 
 		/* Skip the suit character we just processed */
 		str_index++;
@@ -159,24 +450,192 @@ static int php_poker_parse_hand(const char *hand_str, int *cards, int max_cards)
 }
 
 /**
- * Check if a card exists in a deck
+ * Card value of a card id
  *
- * @param card Card value to check
- * @param deck Array of card values to search in
- * @param num_cards Number of cards in the deck
- * @return int 1 if card exists, 0 otherwise
+ * Card ids are suit * 13 + rank, with suits ordered c, d, h, s and ranks
+ * from deuce (0) to ace (12). Bit n of a card mask is card id n.
+ *
+ * @param id Card id (0-51)
+ * @return int Card value
+ */
+static inline int php_poker_card_from_id(int id)
+{
+	return php_poker_make_card(id % 13, id / 13);
+}
+
+/**
+ * Write the two-character name of a card (e.g. "Ah")
+ *
+ * @param name Buffer of at least 3 characters
+ * @param card Card value
+ */
+static void php_poker_card_name(char *name, int card)
+{
+	name[0] = "23456789TJQKA"[RANK(card)];
+	name[1] = "cdhs"[php_poker_suit_index(card)];
+	name[2] = '\0';
+}
+
+/**
+ * Read one card: a card string ("Ah") or a card id
+ *
+ * @param zv Card to read
+ * @param card Receives the card value
+ * @return int SUCCESS or FAILURE
+ */
+static int php_poker_zval_card(zval *zv, int *card)
+{
+	int cards[2];
+
+	if (Z_TYPE_P(zv) == IS_LONG) {
+		if (Z_LVAL_P(zv) < 0 || Z_LVAL_P(zv) > 51) {
+			return FAILURE;
+		}
+
+		*card = php_poker_card_from_id((int)Z_LVAL_P(zv));
+		return SUCCESS;
+	}
+
+	if (Z_TYPE_P(zv) != IS_STRING || php_poker_parse_hand(Z_STRVAL_P(zv), cards, 2) != 1) {
+		return FAILURE;
+	}
+
+	*card = cards[0];
+
+	return SUCCESS;
+}
+
+/**
+ * Read a set of cards given in any supported encoding
+ *
+ * Accepts a card string ("Ah Kd"), a list of card strings or card ids, or
+ * a card mask (an int with bit n set for card id n). Masks list their cards
+ * by increasing id.
+ *
+ * @param zv Cards to read
+ * @param cards Receives the card values (room for max_cards + 1)
+ * @param max_cards Most cards the caller accepts
+ * @return int Number of cards, max_cards + 1 if there are more, or -1 if invalid
+ */
+static int php_poker_zval_cards(zval *zv, int *cards, int max_cards)
+{
+	zval *card_zv;
+	uint64_t mask;
+	int num_cards = 0;
+
+	switch (Z_TYPE_P(zv)) {
+		case IS_STRING:
+			return php_poker_parse_hand(Z_STRVAL_P(zv), cards, max_cards + 1);
+
+		case IS_LONG:
+			mask = (uint64_t)Z_LVAL_P(zv);
+
+			if (mask >> 52) {
+				return -1;
+			}
+
+			while (mask && num_cards <= max_cards) {
+				cards[num_cards++] = php_poker_card_from_id(__builtin_ctzll(mask));
+				mask &= mask - 1;
+			}
+
+			return num_cards;
+
+		case IS_ARRAY:
+			ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(zv), card_zv) {
+				ZVAL_DEREF(card_zv);
+
+				if (num_cards > max_cards) {
+					break;
+				}
+
+				if (php_poker_zval_card(card_zv, &cards[num_cards++]) == FAILURE) {
+					return -1;
+				}
+			} ZEND_HASH_FOREACH_END();
+
+			return num_cards;
+
+		default:
+			return -1;
+	}
+}
+
+/**
+ * Read a player's hole cards, some of which may be unknown
+ *
+ * Like php_poker_zval_cards, but "??" in a card string or as a list entry
+ * stands for a card dealt at random. Unknown cards are counted, not stored.
+ *
+ * @param zv Cards to read
+ * @param cards Receives the known card values (room for max_cards + 1)
+ * @param max_cards Most cards the caller accepts
+ * @param unknown Receives the number of unknown cards
+ * @return int Number of cards, max_cards + 1 if there are more, or -1 if invalid
+ */
+static int php_poker_zval_hole_cards(zval *zv, int *cards, int max_cards, int *unknown)
+{
+	zval *card_zv;
+	int num_cards = 0;
+
+	*unknown = 0;
+
+	switch (Z_TYPE_P(zv)) {
+		case IS_STRING:
+			return php_poker_parse_cards(Z_STRVAL_P(zv), cards, max_cards + 1, unknown);
+
+		case IS_ARRAY:
+			ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(zv), card_zv) {
+				ZVAL_DEREF(card_zv);
+
+				if (num_cards > max_cards) {
+					break;
+				}
+
+				if (Z_TYPE_P(card_zv) == IS_STRING && strcmp(Z_STRVAL_P(card_zv), "??") == 0) {
+					(*unknown)++;
+				} else if (php_poker_zval_card(card_zv, &cards[num_cards - *unknown]) == FAILURE) {
+					return -1;
+				}
+
+				num_cards++;
+			} ZEND_HASH_FOREACH_END();
+
+			return num_cards;
+
+		default:
+			return php_poker_zval_cards(zv, cards, max_cards);
+	}
+}
+
+/**
+ * Card mask of a list of cards
+ *
+ * @param cards Array of card values
+ * @param num_cards Number of cards
+ * @return uint64_t Card mask
  */
-static int php_poker_card_exists(int card, int *deck, int num_cards)
+static uint64_t php_poker_cards_mask(const int *cards, int num_cards)
 {
+	uint64_t mask = 0;
 	int i;
 
 	for (i = 0; i < num_cards; i++) {
-		if (deck[i] == card) {
-			return 1;
-		}
+		mask |= php_poker_card_bit(cards[i]);
 	}
 
-	return 0;
+	return mask;
+}
+
+/**
+ * Number of cards in a card mask
+ *
+ * @param mask Card mask
+ * @return int Number of cards
+ */
+static inline int php_poker_popcount(uint64_t mask)
+{
+	return __builtin_popcountll(mask);
 }
 
 /**
@@ -243,18 +702,27 @@ static unsigned short php_poker_eval_5hand(int *hand)
 }
 
 /**
- * Evaluate a hand of 7 cards - finds the best 5-card hand
+ * Evaluate the best 5-card hand out of 5, 6 or 7 cards by brute force
  *
- * @param hand Array of 7 card values
+ * Walks every row of perm7 that only references cards that are present,
+ * so 5 cards give one subset, 6 cards give six and 7 cards give 21. This is
+ * only used to build the direct lookup tables, never on the hot path.
+ *
+ * @param hand Array of card values
+ * @param num_cards Number of cards in the hand (5-7)
  * @return unsigned short Hand evaluation value (lower is better)
  */
-static unsigned short php_poker_eval_7hand(int *hand)
+static unsigned short php_poker_eval_best_subset(int *hand, int num_cards)
 {
 	int i, j;
 	int subhand[5];
 	unsigned short current_value, best_value = 9999;
 
 	for (i = 0; i < 21; i++) {
+		if (perm7[i][4] >= num_cards) {
+			continue;
+		}
+
 		for (j = 0; j < 5; j++) {
 			subhand[j] = hand[perm7[i][j]];
 		}
@@ -270,500 +738,6696 @@ static unsigned short php_poker_eval_7hand(int *hand)
 }
 
 /**
- * Return the hand rank based on the evaluation value
+ * Find the flush suit (if any) from a packed suit counter
  *
- * @param val Hand evaluation value
- * @return int Hand rank (1-9, where 1 is best)
+ * Each suit owns a nibble of the counter, starting at 3, so a suit that
+ * holds five or more cards has bit 3 of its nibble set. At most one suit
+ * can reach five cards out of seven.
+ *
+ * @param suits Packed suit counter
+ * @return int Suit bit of the flush suit (CLUB..SPADE) or 0 if there is no flush
  */
-static int php_poker_hand_rank(unsigned short val)
+static inline int php_poker_flush_suit(unsigned suits)
 {
-	if (val > 6185) return 9; /* High card */
-	if (val > 3325) return 8; /* One pair */
-	if (val > 2467) return 7; /* Two pair */
-	if (val > 1609) return 6; /* Three of a kind */
-	if (val > 1599) return 5; /* Straight */
-	if (val > 322)  return 4; /* Flush */
-	if (val > 166)  return 3; /* Full house */
-	if (val > 10)   return 2; /* Four of a kind */
+	unsigned f = suits & 0x8888;
 
-	return 1;                 /* Straight flush */
+	return (int)(((f >> 3) & 1) | ((f >> 6) & 2) | ((f >> 9) & 4) | ((f >> 12) & 8)) << 12;
 }
 
 /**
- * Get string representation of hand rank
+ * Map a summed rank key to its slot in php_poker_rank_lookup
  *
- * @param rank Hand rank (1-9)
- * @return const char* String description of the hand
+ * @param key Sum of rank_keys over the hand
+ * @param num_cards Number of cards the key was summed over (6 or 7)
+ * @return unsigned Slot index
  */
-static const char* php_poker_get_hand_name(int rank)
+static inline unsigned php_poker_rank_slot(unsigned key, int num_cards)
 {
-	switch (rank) {
-		case 1: return "Straight Flush";
-		case 2: return "Four of a Kind";
-		case 3: return "Full House";
-		case 4: return "Flush";
-		case 5: return "Straight";
-		case 6: return "Three of a Kind";
-		case 7: return "Two Pair";
-		case 8: return "One Pair";
-		case 9: return "High Card";
-		default: return "Unknown";
-	}
+	const unsigned int *offsets = num_cards == 7 ? rank_offsets7 : rank_offsets6;
+
+	return offsets[key & PHP_POKER_ROW_MASK] + (key >> PHP_POKER_ROW_BITS);
 }
 
 /**
- * Initialize a deck with all 52 cards
+ * Look up the value of a non-flush hand from its summed rank key
  *
- * @param deck Array to store the initialized deck (size must be at least 52)
+ * @param key Sum of rank_keys over the hand
+ * @param num_cards Number of cards the key was summed over (6 or 7)
+ * @return unsigned short Hand evaluation value (lower is better)
  */
-static void php_poker_init_deck(int *deck)
+static inline unsigned short php_poker_rank_value(unsigned key, int num_cards)
 {
-	int i, j, n = 0;
-	int suit = 0x8000;
-
-	for (i = 0; i < 4; i++, suit >>= 1) {
-		for (j = 0; j < 13; j++, n++) {
-			deck[n] = primes[j] | (j << 8) | suit | (1 << (16+j));
-		}
-	}
+	return php_poker_rank_lookup[php_poker_rank_slot(key, num_cards)];
 }
 
 /**
- * Initialize random seed, if necessary
+ * Evaluate a hand of 6 or 7 cards directly
+ *
+ * Non-flush hands are resolved with one lookup of the summed rank keys
+ * through the row displacement tables. Flush hands collect the rank bits of the
+ * flush suit and look up the best flush in php_poker_flush_lookup. Both
+ * return the same 1..7462 values as php_poker_eval_5cards.
+ *
+ * @param hand Array of card values
+ * @param num_cards Number of cards in the hand (6 or 7)
+ * @return unsigned short Hand evaluation value (lower is better)
  */
-static void php_poker_init_random_seed()
+static unsigned short php_poker_eval_nhand(int *hand, int num_cards)
 {
-	static int seeded = 0;
+	unsigned key = 0, suits = PHP_POKER_SUIT_COUNTER_INIT;
+	int i, flush_suit, ranks = 0;
+
+	for (i = 0; i < num_cards; i++) {
+		key += rank_keys[RANK(hand[i])];
+		suits += php_poker_suit_adds[(hand[i] >> 12) & 0xF];
+	}
 
-	if (!seeded) {
-		srand(time(NULL));
-		seeded = 1;
+	flush_suit = php_poker_flush_suit(suits);
+
+	if (flush_suit) {
+		for (i = 0; i < num_cards; i++) {
+			if (hand[i] & flush_suit) {
+				ranks |= hand[i] >> 16;
+			}
+		}
+
+		return php_poker_flush_lookup[ranks];
 	}
+
+	return php_poker_rank_value(key, num_cards);
 }
 
 /**
- * Generate a random number between 0 and limit-1
+ * Summarize board cards for php_poker_eval_board_hand
  *
- * @param limit Upper bound (exclusive)
- * @return int Random number
+ * Holds everything the direct evaluator needs from the board: the summed rank
+ * keys, the packed suit counter and the rank bits of each suit. A showdown
+ * builds it once and then only adds each player's hole cards.
+ *
+ * @param board Receives the board state
+ * @param cards Array of board cards
+ * @param num_cards Number of board cards (4 or 5)
+ * @param game PHP_POKER_GAME_SHORTDECK for short-deck values, hold'em values otherwise
  */
-static int php_poker_rand_int(int limit)
+static void php_poker_init_board_state(php_poker_board_state *board, const int *cards, int num_cards, int game)
 {
-	return (int)(((double)rand() / RAND_MAX) * limit);
+	int i;
+
+	memset(board, 0, sizeof(*board));
+	board->suits = PHP_POKER_SUIT_COUNTER_INIT;
+	board->num_cards = num_cards;
+	board->flush_lookup = game == PHP_POKER_GAME_SHORTDECK ? php_poker_short_flush_lookup : php_poker_flush_lookup;
+	board->rank_lookup = game == PHP_POKER_GAME_SHORTDECK ? php_poker_short_rank_lookup : php_poker_rank_lookup;
+
+	for (i = 0; i < num_cards; i++) {
+		board->key += rank_keys[RANK(cards[i])];
+		board->suits += php_poker_suit_adds[(cards[i] >> 12) & 0xF];
+		board->ranks[(cards[i] >> 12) & 0xF] |= cards[i] >> 16;
+	}
 }
 
 /**
- * Shuffle a deck of cards
+ * Evaluate two hole cards against a summarized board
  *
- * @param deck Array of cards to shuffle
- * @param num_cards Number of cards in the deck
+ * Gives the same value as php_poker_eval_nhand over the hole cards plus the
+ * board, with only the two hole cards left to add.
+ *
+ * @param board Board state from php_poker_init_board_state
+ * @param c1 First hole card
+ * @param c2 Second hole card
+ * @return unsigned short Hand evaluation value (lower is better)
  */
-static void php_poker_shuffle_deck(int *deck, int num_cards)
+static inline unsigned short php_poker_eval_board_hand(const php_poker_board_state *board, int c1, int c2)
 {
-	int i, j, temp;
+	unsigned key = board->key + rank_keys[RANK(c1)] + rank_keys[RANK(c2)];
+	unsigned suits = board->suits + php_poker_suit_adds[(c1 >> 12) & 0xF] + php_poker_suit_adds[(c2 >> 12) & 0xF];
+	int flush_suit = php_poker_flush_suit(suits);
+	int ranks;
 
-	for (i = num_cards - 1; i > 0; i--) {
-		j = php_poker_rand_int(i + 1);
-		temp = deck[j];
-		deck[j] = deck[i];
-		deck[i] = temp;
+	if (flush_suit) {
+		ranks = board->ranks[flush_suit >> 12];
+
+		if (c1 & flush_suit) {
+			ranks |= c1 >> 16;
+		}
+
+		if (c2 & flush_suit) {
+			ranks |= c2 >> 16;
+		}
+
+		return board->flush_lookup[ranks];
 	}
+
+	return board->rank_lookup[php_poker_rank_slot(key, board->num_cards + 2)];
 }
 
 /**
- * Remove cards from the deck that are already in play
+ * Combine the board cards of an Omaha hand into every 3-card subset
  *
- * @param deck Array to store the prepared deck
- * @param used_cards Array of cards already in play
- * @param num_used_cards Number of cards already in play
- * @return int Number of cards in the prepared deck
+ * Each subset keeps what php_poker_eval_5cards needs from its three cards, so
+ * the board is combined once per showdown and every player only adds the
+ * pairs of their hole cards.
+ *
+ * @param board Receives the board subsets
+ * @param cards Array of board cards
+ * @param num_cards Number of board cards (3-5)
  */
-static int php_poker_prepare_deck(int *deck, int *used_cards, int num_used_cards)
+static void php_poker_init_omaha_board(php_poker_omaha_board *board, const int *cards, int num_cards)
 {
-	int full_deck[52];
-	int i, count = 0;
+	int i, j, k;
+
+	board->count = 0;
+
+	for (i = 0; i < num_cards - 2; i++) {
+		for (j = i + 1; j < num_cards - 1; j++) {
+			for (k = j + 1; k < num_cards; k++) {
+				board->ranks[board->count] = (cards[i] | cards[j] | cards[k]) >> 16;
+				board->flush[board->count] = cards[i] & cards[j] & cards[k] & 0xf000;
+				board->primes[board->count] = (cards[i] & 0xff) * (cards[j] & 0xff) * (cards[k] & 0xff);
+				board->low[board->count] = php_poker_low_bits(board->ranks[board->count]);
 
-	/* Initialize full deck */
-	php_poker_init_deck(full_deck);
+				/* Three different ranks, eight or below */
+				if (php_poker_popcount(board->low[board->count]) != 3) {
+					board->low[board->count] = 0;
+				}
 
-	/* Copy cards to deck that are not used */
-	for (i = 0; i < 52; i++) {
-		if (!php_poker_card_exists(full_deck[i], used_cards, num_used_cards)) {
-			/* Ensure we don't go out of bounds */
-			if (count < 52) {
-				deck[count++] = full_deck[i];
+				board->count++;
 			}
 		}
 	}
-
-	return count;
 }
 
 /**
- * PHP Module initialization
+ * Evaluate an Omaha hand: the best of exactly two hole cards with exactly
+ * three board cards
+ *
+ * Each pair of hole cards is combined once and then scored against every
+ * board subset with the same three steps as php_poker_eval_5cards: a shared
+ * suit bit means a flush, five distinct ranks go through unique5, and the
+ * rest through the prime product hash.
+ *
+ * @param board Board subsets from php_poker_init_omaha_board
+ * @param hole Array of hole cards
+ * @param num_hole Number of hole cards (4 or 5)
+ * @return unsigned short Hand evaluation value (lower is better)
  */
-PHP_MINIT_FUNCTION(phpoker)
+static unsigned short php_poker_eval_omaha_hand(const php_poker_omaha_board *board, const int *hole, int num_hole)
 {
-	return SUCCESS;
+	unsigned short value, best = 9999;
+	int i, j, b, ranks, flush, primes, q;
+
+	for (i = 0; i < num_hole - 1; i++) {
+		for (j = i + 1; j < num_hole; j++) {
+			ranks = (hole[i] | hole[j]) >> 16;
+			flush = hole[i] & hole[j] & 0xf000;
+			primes = (hole[i] & 0xff) * (hole[j] & 0xff);
+
+			for (b = 0; b < board->count; b++) {
+				q = board->ranks[b] | ranks;
+
+				if (board->flush[b] & flush) {
+					value = flushes[q];
+				} else if (!(value = unique5[q])) {
+					value = hash_values[php_poker_find_fast(board->primes[b] * primes)];
+				}
+
+				if (value < best) {
+					best = value;
+				}
+			}
+		}
+	}
+
+	return best;
 }
 
 /**
- * PHP Module shutdown
+ * Convert a hold'em hand value to its short-deck value
+ *
+ * Short deck ranks flushes above full houses, so the two blocks of values
+ * trade places, and A-6-7-8-9 is the lowest straight. It takes the value of
+ * the 9-high straight (flush), which no 36-card deck can make otherwise.
+ * The scale stays 1..7462, with 1 the best.
+ *
+ * @param value Hold'em value of the best hand
+ * @param ranks Rank bits of the cards (of the flush suit for flushes)
+ * @param flush Whether the value comes from a flush lookup
+ * @return unsigned short Short-deck hand value (lower is better)
  */
-PHP_MSHUTDOWN_FUNCTION(phpoker)
+static unsigned short php_poker_short_value(unsigned short value, int ranks, int flush)
 {
-	return SUCCESS;
+	unsigned short wheel = flush ? 6 : 1605;
+
+	if (value >= 167 && value <= 322) {
+		value += 1277; /* Full houses: 1444-1599 */
+	} else if (value >= 323 && value <= 1599) {
+		value -= 156;  /* Flushes: 167-1443 */
+	}
+
+	if ((ranks & PHP_POKER_SHORT_WHEEL) == PHP_POKER_SHORT_WHEEL && value > wheel) {
+		value = wheel;
+	}
+
+	return value;
 }
 
 /**
- * PHP Module info
+ * Evaluate a short-deck hand of 5 to 7 cards
+ *
+ * @param cards Array of card values (six or higher)
+ * @param num_cards Number of cards (5-7)
+ * @return unsigned short Short-deck hand value (lower is better)
  */
-PHP_MINFO_FUNCTION(phpoker)
+static unsigned short php_poker_eval_short_cards(int *cards, int num_cards)
 {
-	php_info_print_table_start();
-	php_info_print_table_header(2, "phpoker support", "enabled");
-	php_info_print_table_row(2, "Version", PHP_PHPOKER_VERSION);
-	php_info_print_table_row(2, "Author", "Nick Poulos");
-	php_info_print_table_end();
+	php_poker_board_state board;
+
+	if (num_cards == 5) {
+		return php_poker_short_value(php_poker_eval_5hand(cards), (cards[0] | cards[1] | cards[2] | cards[3] | cards[4]) >> 16,
+			cards[0] & cards[1] & cards[2] & cards[3] & cards[4] & 0xf000);
+	}
+
+	php_poker_init_board_state(&board, &cards[2], num_cards - 2, PHP_POKER_GAME_SHORTDECK);
+
+	return php_poker_eval_board_hand(&board, cards[0], cards[1]);
 }
 
 /**
- * Evaluate a poker hand and return information about it
+ * Evaluate a hand of 6 cards - finds the best 5-card hand
  *
- * This function takes a string representation of a poker hand,
- * evaluates it, and returns an array with information about the hand.
+ * @param hand Array of 6 card values
+ * @return unsigned short Hand evaluation value (lower is better)
+ */
+static unsigned short php_poker_eval_6hand(int *hand)
+{
+	return php_poker_eval_nhand(hand, 6);
+}
+
+/**
+ * Evaluate a hand of 7 cards - finds the best 5-card hand
  *
- * @param string $hand String representation of the hand (e.g. "Ah Kd Qc Js Th")
- * @return array Array with hand information (value, rank, name, cards)
+ * @param hand Array of 7 card values
+ * @return unsigned short Hand evaluation value (lower is better)
  */
-PHP_FUNCTION(poker_evaluate_hand)
+static unsigned short php_poker_eval_7hand(int *hand)
 {
-	char *hand_str;
-	size_t hand_len;
-	int cards[7]; /* Increased max size to 7 */
-	int num_cards;
-	unsigned short eval_result;
-	int hand_type;
+	return php_poker_eval_nhand(hand, 7);
+}
 
-	/* Parse function arguments */
-	if (zend_parse_parameters(ZEND_NUM_ARGS(), "s", &hand_str, &hand_len) == FAILURE) {
-		RETURN_NULL();
-	}
+/**
+ * Fill php_poker_flush_lookup with the best flush for every rank mask
+ *
+ * Masks with exactly five bits come straight from flushes[]; larger masks
+ * take the best of the masks with one bit removed. The short-deck table
+ * follows from each entry, since the conversion keeps flushes in order.
+ */
+static void php_poker_init_flush_lookup(void)
+{
+	int mask, bit, bits;
+	unsigned short best;
 
-	/* Parse the hand string into cards */
-	num_cards = php_poker_parse_hand(hand_str, cards, 7); /* Increased max size to 7 */
+	for (mask = 0; mask < 8192; mask++) {
+		php_poker_flush_lookup[mask] = 0;
 
-	/* Check for invalid cards */
-	if (num_cards == -1) {
-		zend_throw_exception(zend_ce_exception, "Invalid card format in hand", 0);
-		RETURN_NULL();
-	}
+		for (bits = 0, bit = mask; bit; bit &= bit - 1) {
+			bits++;
+		}
 
-	/* Check for correct number of cards */
-	if (num_cards != 5 && num_cards != 7) {
-		zend_throw_exception(zend_ce_exception, "Invalid number of cards (need exactly 5 or 7)", 0);
-		RETURN_NULL();
-	}
+		if (bits == 5) {
+			php_poker_flush_lookup[mask] = flushes[mask];
+		} else if (bits > 5) {
+			best = 9999;
 
-	/* Evaluate the hand */
-	if (num_cards == 5) {
-		eval_result = php_poker_eval_5hand(cards);
-	} else { /* Must be 7 */
-		eval_result = php_poker_eval_7hand(cards);
-	}
+			for (bit = 1; bit < 8192; bit <<= 1) {
+				if ((mask & bit) && php_poker_flush_lookup[mask & ~bit] < best) {
+					best = php_poker_flush_lookup[mask & ~bit];
+				}
+			}
 
-	/* Get the hand type */
-	hand_type = php_poker_hand_rank(eval_result);
+			php_poker_flush_lookup[mask] = best;
+		}
 
-	/* Create return array with hand info */
-	array_init(return_value);
-	add_assoc_long(return_value, "value", eval_result);
-	add_assoc_long(return_value, "rank", hand_type);
-	add_assoc_string(return_value, "name", (char*)php_poker_get_hand_name(hand_type));
-	add_assoc_long(return_value, "cards", num_cards); /* Add card count to output */
+		php_poker_short_flush_lookup[mask] = bits >= 5 ? php_poker_short_value(php_poker_flush_lookup[mask], mask, 1) : 0;
+	}
 }
 
 /**
- * Calculate equity percentages for multiple poker hands
+ * Fill the rank lookup for every rank multiset of the requested size
  *
- * This function simulates many poker hands to determine the equity (winning percentage)
- * for each player in various situations.
+ * 6-card hands are dealt to the suits round-robin so no combination can form
+ * a flush, and the best of their six subsets is stored. 7-card hands take
+ * the best of the 6-card hands left after removing one card, so the 6-card
+ * pass must run first. The short-deck entry is converted from the hold'em
+ * one, which keeps non-flush hands in order apart from A-6-7-8-9.
  *
- * @param array $hole_cards Array of strings representing each player's hole cards
- * @param array $board_cards Optional array of strings representing the board cards
- * @param int $iterations Optional number of iterations to run (default: 10000)
- * @param array $dead_cards Optional array of strings representing cards that are no longer in the deck
- * @return array Array with equity information for each player
+ * @param counts Per-rank card counts being built
+ * @param rank Next rank to assign a count to
+ * @param left Number of cards still to assign
+ * @param num_cards Total number of cards in the hand (6 or 7)
  */
-PHP_FUNCTION(poker_calculate_equity)
+static void php_poker_fill_rank_lookup(int *counts, int rank, int left, int num_cards)
 {
-	zval *hole_cards_array, *board_cards_array = NULL, *dead_cards_array = NULL;
-	HashTable *hole_cards_hash, *board_cards_hash = NULL, *dead_cards_hash = NULL;
-	zval *hole_cards_item;
-	zval *board_cards_item;
-	zval *dead_cards_item;
-	zend_long iterations = 10000;
+	int hand[6];
+	int i, j, n, c, ranks;
+	unsigned key, value, best;
 
-	int num_players, i, j, h, b, d;
-	int board_count = 0;
-	int dead_count = 0;
-	int used_cards_count = 0;
-	int remaining_board_count = 0;
-	int remaining_deck_count = 0;
-	int player_hands[10][7]; /* Max 10 players, 7 cards per hand */
-	int board_cards[5];      /* Max 5 board cards */
-	int dead_cards[52];      /* Max 52 dead cards (though this is overkill) */
-	int used_cards[52];      /* Track all cards in use */
-	int deck[52];            /* Remaining cards in the deck */
-	int wins[10] = {0};      /* Win counter for each player */
-	int ties[10] = {0};      /* Tie counter for each player */
-	unsigned short scores[10]; /* Score for each player in a given hand */
-	double equity[10] = {0.0}; /* Equity percentage for each player */
+	if (rank == 13) {
+		if (left) {
+			return;
+		}
 
-	/* Initialize the random seed for shuffling */
-	php_poker_init_random_seed();
+		for (i = 0, key = 0, ranks = 0; i < 13; i++) {
+			key += counts[i] * rank_keys[i];
+			ranks |= counts[i] ? 1 << i : 0;
+		}
 
-	ZEND_PARSE_PARAMETERS_START(1, 4)
-		Z_PARAM_ARRAY(hole_cards_array)
-		Z_PARAM_OPTIONAL
-		Z_PARAM_ARRAY_OR_NULL(board_cards_array)
-		Z_PARAM_LONG(iterations)
-		Z_PARAM_ARRAY_OR_NULL(dead_cards_array)
-	ZEND_PARSE_PARAMETERS_END();
+		if (num_cards == 6) {
+			for (i = 0, n = 0; i < 13; i++) {
+				for (j = 0; j < counts[i]; j++, n++) {
+					hand[n] = php_poker_make_card(i, n & 3);
+				}
+			}
 
-	/* Get hash tables from zvals */
-	hole_cards_hash = Z_ARRVAL_P(hole_cards_array);
-	num_players = zend_hash_num_elements(hole_cards_hash);
+			best = php_poker_eval_best_subset(hand, 6);
+		} else {
+			for (i = 0, best = 9999; i < 13; i++) {
+				if (counts[i] && (value = php_poker_rank_value(key - rank_keys[i], 6)) < best) {
+					best = value;
+				}
+			}
+		}
 
-	/* Check if we have at least 2 players */
-	if (num_players < 2) {
-		zend_throw_exception(zend_ce_exception, "At least 2 players needed for equity calculation", 0);
-		RETURN_NULL();
+		php_poker_rank_lookup[php_poker_rank_slot(key, num_cards)] = (unsigned short)best;
+		php_poker_short_rank_lookup[php_poker_rank_slot(key, num_cards)] = php_poker_short_value((unsigned short)best, ranks, 0);
+		return;
 	}
 
-	/* Check for reasonable iteration count */
-	if (iterations <= 0) {
-		iterations = 10000; /* Default to 10,000 if invalid */
-	} else if (iterations > 1000000) {
-		iterations = 1000000; /* Cap at 1,000,000 for performance */
+	for (c = 0; c <= 4 && c <= left; c++) {
+		counts[rank] = c;
+		php_poker_fill_rank_lookup(counts, rank + 1, left - c, num_cards);
 	}
 
-	/* Get board cards if provided */
-	if (board_cards_array != NULL && Z_TYPE_P(board_cards_array) == IS_ARRAY) {
-		board_cards_hash = Z_ARRVAL_P(board_cards_array);
-		board_count = zend_hash_num_elements(board_cards_hash);
+	counts[rank] = 0;
+}
 
-		/* Ensure we don't have too many board cards */
-		if (board_count > 5) {
-			zend_throw_exception(zend_ce_exception, "Board cannot have more than 5 cards", 0);
-			RETURN_NULL();
+/**
+ * Build the direct 6- and 7-card lookup tables
+ */
+static void php_poker_init_eval_tables(void)
+{
+	int counts[13] = {0};
+
+	php_poker_init_flush_lookup();
+	php_poker_fill_rank_lookup(counts, 0, 6, 6);
+	php_poker_fill_rank_lookup(counts, 0, 7, 7);
+	php_poker_init_low_lookup();
+}
+
+/**
+ * Fill php_poker_low_lookup
+ *
+ * Lows compare by their highest card first, so with ace as bit 0 the best
+ * low of a set of ranks is its five lowest bits, and a smaller mask of five
+ * bits is a better low. The 56 possible lows are numbered in that order.
+ */
+static void php_poker_init_low_lookup(void)
+{
+	unsigned char values[256] = {0};
+	int mask, low, value = 0;
+
+	for (mask = 0; mask < 256; mask++) {
+		if (php_poker_popcount(mask) == 5) {
+			values[mask] = (unsigned char)++value;
 		}
 	}
 
-	/* Get dead cards if provided */
-	if (dead_cards_array != NULL && Z_TYPE_P(dead_cards_array) == IS_ARRAY) {
-		dead_cards_hash = Z_ARRVAL_P(dead_cards_array);
-		dead_count = zend_hash_num_elements(dead_cards_hash);
-	}
+	for (mask = 0; mask < 256; mask++) {
+		low = mask;
 
-	/* Parse the hole cards for each player */
-	i = 0;
-	ZEND_HASH_FOREACH_VAL(hole_cards_hash, hole_cards_item) {
-		if (i >= 10) {
-			break; /* Limit to 10 players for sanity */
+		/* Drop the highest rank until five are left */
+		while (php_poker_popcount(low) > 5) {
+			low &= ~(1 << (31 - __builtin_clz(low)));
 		}
 
-		if (Z_TYPE_P(hole_cards_item) != IS_STRING) {
-			zend_throw_exception(zend_ce_exception, "Hole cards must be strings", 0);
-			RETURN_NULL();
-		}
+		php_poker_low_lookup[mask] = php_poker_popcount(low) == 5 ? values[low] : 0;
+	}
+}
 
-		int num_hole_cards = php_poker_parse_hand(Z_STRVAL_P(hole_cards_item), player_hands[i], 2);
+/**
+ * Map rank bits (deuce = bit 0 ... ace = bit 12) to ace-to-five low bits
+ *
+ * Ace becomes bit 0 and deuce to eight bits 1 to 7; nine and above drop
+ * out, since they cannot be part of an eight-or-better low.
+ *
+ * @param ranks Rank bits, as in bits 16-28 of a card value
+ * @return int Low bits (0-255)
+ */
+static inline int php_poker_low_bits(int ranks)
+{
+	return ((ranks << 1) | (ranks >> 12)) & 0xff;
+}
 
-		if (num_hole_cards != 2) {
-			zend_throw_exception(zend_ce_exception, "Each player must have exactly 2 hole cards", 0);
-			RETURN_NULL();
-		}
+/**
+ * Evaluate the ace-to-five eight-or-better low of 5 to 7 cards
+ *
+ * Any five cards may be used; pairs, straights and flushes do not count.
+ *
+ * @param cards Array of card values
+ * @param num_cards Number of cards
+ * @return int Low value (1 is 5-4-3-2-A, 56 is 8-7-6-5-4), 0 when there is no low
+ */
+static int php_poker_eval_low(const int *cards, int num_cards)
+{
+	int i, ranks = 0;
+
+	for (i = 0; i < num_cards; i++) {
+		ranks |= cards[i] >> 16;
+	}
 
-		/* Add player hole cards to used cards array */
-		used_cards[used_cards_count++] = player_hands[i][0];
-		used_cards[used_cards_count++] = player_hands[i][1];
+	return php_poker_low_lookup[php_poker_low_bits(ranks)];
+}
 
-		i++;
-	} ZEND_HASH_FOREACH_END();
+/**
+ * Evaluate a deuce-to-seven lowball hand of 5 cards
+ *
+ * Aces are always high and straights and flushes count against the hand, so
+ * the order is the hold'em order reversed, except that A-5-4-3-2 is no
+ * straight. It slots in just ahead of A-6-4-3-2 (or the A-6-4-3-2 flush),
+ * which moves the hands below it up by one.
+ *
+ * @param cards Array of 5 card values
+ * @return unsigned short Lowball value (1 is 7-5-4-3-2, 7464 is a royal flush)
+ */
+static unsigned short php_poker_eval_deuce_seven(int *cards)
+{
+	unsigned short value = php_poker_eval_5hand(cards);
+	int ranks = (cards[0] | cards[1] | cards[2] | cards[3] | cards[4]) >> 16;
+	int flush = cards[0] & cards[1] & cards[2] & cards[3] & cards[4] & 0xf000;
 
-	num_players = i; /* In case we hit the 10 player limit */
+	if (ranks == PHP_POKER_WHEEL) {
+		return flush ? 7464 - PHP_POKER_ACE_SIX_FLUSH : 7463 - PHP_POKER_ACE_SIX_HIGH;
+	}
 
-	/* Parse the board cards */
-	if (board_count > 0) {
-		i = 0;
-		ZEND_HASH_FOREACH_VAL(board_cards_hash, board_cards_item) {
-			if (i >= 5) {
-				break; /* Limit to 5 board cards */
-			}
+	if (value > PHP_POKER_ACE_SIX_HIGH) {
+		return 7463 - value;
+	}
 
-			if (Z_TYPE_P(board_cards_item) != IS_STRING) {
-				zend_throw_exception(zend_ce_exception, "Board cards must be strings", 0);
-				RETURN_NULL();
-			}
+	return value > PHP_POKER_ACE_SIX_FLUSH ? 7464 - value : 7465 - value;
+}
+
+/**
+ * Evaluate the ace-to-five eight-or-better low of an Omaha hand
+ *
+ * The low needs exactly two hole cards and three board cards, each of a
+ * different rank eight or below, so only board subsets and hole pairs that
+ * qualify on their own are combined.
+ *
+ * @param board Board subsets from php_poker_init_omaha_board
+ * @param hole Array of hole cards
+ * @param num_hole Number of hole cards (4 or 5)
+ * @return int Low value (1 is best), 0 when there is no low
+ */
+static int php_poker_eval_omaha_low(const php_poker_omaha_board *board, const int *hole, int num_hole)
+{
+	int i, j, b, low, value, best = 0;
 
-			int num_parsed = php_poker_parse_hand(Z_STRVAL_P(board_cards_item), &board_cards[i], 1);
+	for (i = 0; i < num_hole - 1; i++) {
+		for (j = i + 1; j < num_hole; j++) {
+			low = php_poker_low_bits((hole[i] | hole[j]) >> 16);
 
-			if (num_parsed != 1) {
-				zend_throw_exception(zend_ce_exception, "Invalid board card format", 0);
-				RETURN_NULL();
+			if (php_poker_popcount(low) != 2) {
+				continue;
 			}
 
-			/* Check for duplicates */
-			if (php_poker_card_exists(board_cards[i], used_cards, used_cards_count)) {
-				zend_throw_exception(zend_ce_exception, "Duplicate card found on board", 0);
-				RETURN_NULL();
+			for (b = 0; b < board->count; b++) {
+				if (board->low[b] && !(board->low[b] & low)) {
+					value = php_poker_low_lookup[board->low[b] | low];
+
+					if (!best || value < best) {
+						best = value;
+					}
+				}
 			}
+		}
+	}
 
-			/* Add to used cards */
-			used_cards[used_cards_count++] = board_cards[i];
+	return best;
+}
 
-			i++;
-		} ZEND_HASH_FOREACH_END();
+/**
+ * Write the name of an ace-to-five low (e.g. "8-6-4-2-A")
+ *
+ * @param name Buffer of at least 10 bytes
+ * @param value Low value (1-56)
+ */
+static void php_poker_low_name(char *name, int value)
+{
+	int mask, bit, n = 0;
 
-		board_count = i;
+	for (mask = 0; mask < 256; mask++) {
+		if (php_poker_popcount(mask) == 5 && php_poker_low_lookup[mask] == value) {
+			break;
+		}
 	}
 
-	/* Parse the dead cards */
-	if (dead_count > 0) {
-		i = 0;
-		ZEND_HASH_FOREACH_VAL(dead_cards_hash, dead_cards_item) {
-			if (i >= 52) {
-				break; /* Safety limit */
+	for (bit = 7; bit >= 0; bit--) {
+		if (mask & (1 << bit)) {
+			if (n) {
+				name[n++] = '-';
 			}
 
-			if (Z_TYPE_P(dead_cards_item) != IS_STRING) {
-				zend_throw_exception(zend_ce_exception, "Dead cards must be strings", 0);
-				RETURN_NULL();
-			}
+			name[n++] = "A2345678"[bit];
+		}
+	}
 
-			/* Parse single card from the string */
-			int temp_card[1];
-			int num_parsed = php_poker_parse_hand(Z_STRVAL_P(dead_cards_item), temp_card, 1);
+	name[n] = '\0';
+}
 
-			if (num_parsed != 1) {
-				zend_throw_exception(zend_ce_exception, "Invalid dead card format", 0);
-				RETURN_NULL();
-			}
+/**
+ * Map a card value to its suit index (clubs=0, diamonds=1, hearts=2, spades=3)
+ *
+ * @param card Card value
+ * @return int Suit index
+ */
+static inline int php_poker_suit_index(int card)
+{
+	static const int suit_index[16] = { 0, 3, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
-		/* Store the parsed card */
-		dead_cards[i] = temp_card[0];
+	return suit_index[(card >> 12) & 0xF];
+}
 
-			/* Check for duplicates with used cards */
-			if (php_poker_card_exists(dead_cards[i], used_cards, used_cards_count)) {
-				zend_throw_exception(zend_ce_exception, "Dead card already in use by player or on board", 0);
-				RETURN_NULL();
-			}
+/**
+ * Build a card value from a rank (0-12) and a suit index (0-3)
+ *
+ * @param rank Rank of the card (deuce=0 ... ace=12)
+ * @param suit Suit index (clubs=0, diamonds=1, hearts=2, spades=3)
+ * @return int Card value
+ */
+static inline int php_poker_make_card(int rank, int suit)
+{
+	return primes[rank] | (rank << 8) | (CLUB >> suit) | (1 << (16 + rank));
+}
 
-		/* Add to used cards */
-		if (used_cards_count >= 52) {
-			zend_throw_exception(zend_ce_exception, "Too many used cards in play", 0);
-			RETURN_NULL();
-		}
-		used_cards[used_cards_count++] = dead_cards[i];
+/**
+ * Map a card value to its Two Plus Two card number (1-52)
+ *
+ * @param card Card value
+ * @return int Card number used to index the state table
+ */
+static inline int php_poker_tpt_card(int card)
+{
+	return (RANK(card) << 2) + php_poker_suit_index(card) + 1;
+}
 
-			i++;
-		} ZEND_HASH_FOREACH_END();
+/**
+ * Walk the Two Plus Two state table over a list of cards
+ *
+ * Start from PHP_POKER_TPT_START. After seven cards the result is the hand
+ * value; after five or six cards it is a state whose slot 0 holds the value.
+ *
+ * @param state State to start from
+ * @param cards Array of card values
+ * @param num_cards Number of cards to add
+ * @return int Resulting state (or hand value after the seventh card)
+ */
+static inline int php_poker_tpt_walk(int state, int *cards, int num_cards)
+{
+	int i;
 
-		dead_count = i;
+	for (i = 0; i < num_cards; i++) {
+		state = php_poker_tpt[state + php_poker_tpt_card(cards[i])];
 	}
 
-	/* Guard against impossible deck states */
-	if (used_cards_count > 52) {
-		zend_throw_exception(zend_ce_exception, "Too many used cards in play", 0);
-		RETURN_NULL();
-	}
+	return state;
+}
 
-	/* Calculate how many more board cards we need to deal */
-	remaining_board_count = 5 - board_count;
+/**
+ * Evaluate a hand of 5, 6 or 7 cards with the Two Plus Two state table
+ *
+ * @param hand Array of card values
+ * @param num_cards Number of cards in the hand (5-7)
+ * @return unsigned short Hand evaluation value (lower is better)
+ */
+static unsigned short php_poker_tpt_eval(int *hand, int num_cards)
+{
+	int state = php_poker_tpt_walk(PHP_POKER_TPT_START, hand, num_cards);
 
-	if (used_cards_count + remaining_board_count > 52) {
-		zend_throw_exception(zend_ce_exception, "Not enough cards left in deck after removing used/dead cards", 0);
-		RETURN_NULL();
+	if (num_cards < 7) {
+		state = php_poker_tpt[state];
 	}
 
-	/* Prepare the deck (remove all used cards) */
-	remaining_deck_count = php_poker_prepare_deck(deck, used_cards, used_cards_count);
+	return (unsigned short)state;
+}
 
-	/* Check if we have enough cards left */
-	if (remaining_deck_count < remaining_board_count) {
-		zend_throw_exception(zend_ce_exception, "Not enough cards left in deck after removing used/dead cards", 0);
-		RETURN_NULL();
-	}
+/**
+ * Add a card to a Two Plus Two state id
+ *
+ * An id packs up to seven cards, one per byte, as (rank + 1) << 4 | (suit + 1),
+ * sorted in descending order. Once a suit can no longer reach five cards by
+ * the seventh card its suit nibble is cleared, which merges all states that
+ * only differ by irrelevant suits.
+ *
+ * @param id Id of the current state
+ * @param card Card number to add (1-52)
+ * @param num_cards Receives the number of cards in the new id
+ * @return php_poker_tpt_id New id, or 0 if the card cannot be added
+ */
+static php_poker_tpt_id php_poker_tpt_make_id(php_poker_tpt_id id, int card, int *num_cards)
+{
+	int wk[8] = {0};
+	int suit_count[5] = {0};
+	int rank_count[14] = {0};
+	int i, j, n, temp, need_suited;
+	php_poker_tpt_id new_id = 0;
 
-	/* Main simulation loop */
-	for (i = 0; i < iterations; i++) {
-		/* Shuffle the deck for this iteration */
-		php_poker_shuffle_deck(deck, remaining_deck_count);
+	for (i = 0; i < 6; i++) {
+		wk[i + 1] = (int)((id >> (8 * i)) & 0xff);
+	}
 
-		/* Deal remaining board cards */
-		for (j = 0; j < remaining_board_count; j++) {
-			board_cards[board_count + j] = deck[j];
-		}
+	card--;
+	wk[0] = (((card >> 2) + 1) << 4) + (card & 3) + 1;
 
-		/* Evaluate each player's hand */
-		for (j = 0; j < num_players; j++) {
-			/* Combine hole cards with board cards to form a 7-card hand */
-			int full_hand[7];
-			full_hand[0] = player_hands[j][0];
-			full_hand[1] = player_hands[j][1];
+	for (n = 0; wk[n]; n++) {
+		suit_count[wk[n] & 0xf]++;
+		rank_count[(wk[n] >> 4) & 0xf]++;
 
-			/* Add the board cards */
-			for (h = 0; h < 5; h++) {
-				full_hand[2 + h] = board_cards[h];
-			}
+		/* Same card twice */
+		if (n && wk[0] == wk[n]) {
+			return 0;
+		}
+	}
 
-			/* Evaluate the hand */
-			scores[j] = php_poker_eval_7hand(full_hand);
+	for (i = 1; i < 14; i++) {
+		if (rank_count[i] > 4) {
+			return 0;
 		}
+	}
 
-		/* Find the best score (lowest value is best) */
-		unsigned short best_score = 9999;
-		int winners = 0;
-		int winner_indices[10] = {0};
+	/* Drop the suit of cards whose suit can no longer make a flush */
+	need_suited = n - 2;
 
-		for (j = 0; j < num_players; j++) {
-			if (scores[j] < best_score) {
-				best_score = scores[j];
-				winners = 1;
-				winner_indices[0] = j;
-			} else if (scores[j] == best_score) {
-				winner_indices[winners++] = j;
+	if (need_suited > 1) {
+		for (i = 0; i < n; i++) {
+			if (suit_count[wk[i] & 0xf] < need_suited) {
+				wk[i] &= 0xf0;
 			}
 		}
+	}
 
-		/* Update win/tie counters */
-		if (winners == 1) {
-			wins[winner_indices[0]]++;
-		} else {
-			/* It's a tie between multiple players */
-			for (j = 0; j < winners; j++) {
-				ties[winner_indices[j]]++;
-			}
+	/* Sort descending */
+	for (i = 1; i < n; i++) {
+		temp = wk[i];
+
+		for (j = i; j > 0 && wk[j - 1] < temp; j--) {
+			wk[j] = wk[j - 1];
 		}
+
+		wk[j] = temp;
 	}
 
-	/* Calculate equity percentages */
-	for (i = 0; i < num_players; i++) {
-		equity[i] = (double)(wins[i] + (ties[i] / (double)2)) / iterations * 100.0;
+	for (i = 0; i < n; i++) {
+		new_id |= (php_poker_tpt_id)wk[i] << (8 * i);
 	}
 
-	/* Return the results */
-	array_init(return_value);
+	*num_cards = n;
 
-	for (i = 0; i < num_players; i++) {
-		zval player_result;
-		array_init(&player_result);
+	return new_id;
+}
 
-		add_assoc_double(&player_result, "equity", equity[i]);
-		add_assoc_long(&player_result, "wins", wins[i]);
-		add_assoc_long(&player_result, "ties", ties[i]);
+/**
+ * Evaluate the hand described by a Two Plus Two state id
+ *
+ * Cards whose suit was dropped are dealt round-robin to the suits other than
+ * the one suit that is still tracked, so they can never complete a flush.
+ *
+ * @param id State id with 5, 6 or 7 cards
+ * @return unsigned short Hand evaluation value (lower is better)
+ */
+static unsigned short php_poker_tpt_eval_id(php_poker_tpt_id id)
+{
+	int hand[7];
+	int i, n, rank, suit, main_suit = -1, next_suit = 0;
 
-		add_next_index_zval(return_value, &player_result);
+	for (n = 0; n < 7 && ((id >> (8 * n)) & 0xff); n++) {
+		if ((id >> (8 * n)) & 0xf) {
+			main_suit = (int)((id >> (8 * n)) & 0xf) - 1;
+		}
 	}
+
+	for (i = 0; i < n; i++) {
+		rank = (int)((id >> (8 * i + 4)) & 0xf) - 1;
+		suit = (int)((id >> (8 * i)) & 0xf) - 1;
+
+		if (suit < 0) {
+			if (next_suit == main_suit) {
+				next_suit = (next_suit + 1) & 3;
+			}
+
+			suit = next_suit;
+			next_suit = (next_suit + 1) & 3;
+		}
+
+		hand[i] = php_poker_make_card(rank, suit);
+	}
+
+	if (n == 5) {
+		return php_poker_eval_5hand(hand);
+	}
+
+	return php_poker_eval_nhand(hand, n);
+}
+
+/**
+ * Generate the Two Plus Two state table and write it to a file
+ *
+ * States are discovered breadth-first from the empty hand; each one owns 53
+ * slots: slot 0 holds the value of a 5- or 6-card state and slot c holds the
+ * state reached by adding card c (or the final value for a 6-card state).
+ * The file is written next to the target and renamed into place, so
+ * concurrent readers never see a partial table.
+ *
+ * @param path File to write
+ * @return int SUCCESS or FAILURE
+ */
+static int php_poker_tpt_generate(const char *path)
+{
+	php_poker_tpt_id *ids, new_id;
+	php_poker_tpt_header header;
+	int *table, *index;
+	int num_ids = 1, num_cards, id_cards, state, card, slot;
+	size_t tmp_len = strlen(path) + 32;
+	char *tmp_path;
+	FILE *fp;
+	int result = FAILURE;
+
+	tmp_path = pemalloc(tmp_len, 1);
+	snprintf(tmp_path, tmp_len, "%s.%ld.tmp", path, (long)getpid());
+
+	/* Fail early if the target directory is not writable */
+	if ((fp = fopen(tmp_path, "wb")) == NULL) {
+		pefree(tmp_path, 1);
+		return FAILURE;
+	}
+
+	ids = pecalloc(PHP_POKER_TPT_STATES, sizeof(php_poker_tpt_id), 1);
+	index = pemalloc(sizeof(int) * PHP_POKER_TPT_HASH_SIZE, 1);
+	table = pecalloc(PHP_POKER_TPT_SIZE, sizeof(int), 1);
+
+	memset(index, -1, sizeof(int) * PHP_POKER_TPT_HASH_SIZE);
+
+	for (state = 0; state < num_ids; state++) {
+		for (id_cards = 0; id_cards < 7 && ((ids[state] >> (8 * id_cards)) & 0xff); id_cards++);
+
+		for (card = 1; card <= 52; card++) {
+			new_id = php_poker_tpt_make_id(ids[state], card, &num_cards);
+
+			if (!new_id) {
+				continue;
+			}
+
+			if (num_cards == 7) {
+				table[PHP_POKER_TPT_START + 53 * state + card] = php_poker_tpt_eval_id(new_id);
+				continue;
+			}
+
+			/* Find or add the new state (open addressing on the id) */
+			slot = (int)((new_id * 0x9E3779B97F4A7C15ULL) >> (64 - PHP_POKER_TPT_HASH_BITS));
+
+			while (index[slot] >= 0 && ids[index[slot]] != new_id) {
+				slot = (slot + 1) & (PHP_POKER_TPT_HASH_SIZE - 1);
+			}
+
+			if (index[slot] < 0) {
+				if (num_ids >= PHP_POKER_TPT_STATES) {
+					fclose(fp);
+					unlink(tmp_path);
+					goto done;
+				}
+
+				ids[num_ids] = new_id;
+				index[slot] = num_ids++;
+			}
+
+			table[PHP_POKER_TPT_START + 53 * state + card] = PHP_POKER_TPT_START + 53 * index[slot];
+		}
+
+		if (id_cards == 5 || id_cards == 6) {
+			table[PHP_POKER_TPT_START + 53 * state] = php_poker_tpt_eval_id(ids[state]);
+		}
+	}
+
+	memcpy(header.magic, PHP_POKER_TPT_MAGIC, sizeof(header.magic));
+	header.version = PHP_POKER_TPT_VERSION;
+	header.entries = PHP_POKER_TPT_SIZE;
+
+	if (fwrite(&header, sizeof(header), 1, fp) != 1
+		|| fwrite(table, sizeof(int), PHP_POKER_TPT_SIZE, fp) != PHP_POKER_TPT_SIZE) {
+		fclose(fp);
+		unlink(tmp_path);
+		goto done;
+	}
+
+	if (fclose(fp) != 0 || rename(tmp_path, path) != 0) {
+		unlink(tmp_path);
+		goto done;
+	}
+
+	result = SUCCESS;
+
+done:
+	pefree(ids, 1);
+	pefree(index, 1);
+	pefree(table, 1);
+	pefree(tmp_path, 1);
+
+	return result;
+}
+
+/**
+ * Map a Two Plus Two state table file read-only
+ *
+ * The mapping is shared, so every process that maps the same file (e.g. all
+ * php-fpm children, which also inherit it from the master) uses one copy in
+ * the page cache. Transparent huge pages are requested where supported.
+ *
+ * @param path File to map
+ * @return int SUCCESS or FAILURE
+ */
+static int php_poker_tpt_map(const char *path)
+{
+	const php_poker_tpt_header *header;
+	struct stat st;
+	void *base;
+	int fd;
+
+	if ((fd = open(path, O_RDONLY)) < 0) {
+		return FAILURE;
+	}
+
+	if (fstat(fd, &st) != 0 || (size_t)st.st_size != PHP_POKER_TPT_FILE_SIZE) {
+		close(fd);
+		return FAILURE;
+	}
+
+	base = mmap(NULL, PHP_POKER_TPT_FILE_SIZE, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if (base == MAP_FAILED) {
+		return FAILURE;
+	}
+
+	header = (const php_poker_tpt_header *)base;
+
+	if (memcmp(header->magic, PHP_POKER_TPT_MAGIC, sizeof(header->magic)) != 0
+		|| header->version != PHP_POKER_TPT_VERSION
+		|| header->entries != PHP_POKER_TPT_SIZE) {
+		munmap(base, PHP_POKER_TPT_FILE_SIZE);
+		return FAILURE;
+	}
+
+#ifdef MADV_HUGEPAGE
+	madvise(base, PHP_POKER_TPT_FILE_SIZE, MADV_HUGEPAGE);
+#endif
+
+	php_poker_tpt_base = base;
+	php_poker_tpt = (const int *)((const char *)base + sizeof(php_poker_tpt_header));
+
+	return SUCCESS;
+}
+
+/**
+ * Release the Two Plus Two state table mapping, if any
+ */
+static void php_poker_tpt_unmap(void)
+{
+	if (php_poker_tpt_base) {
+		munmap(php_poker_tpt_base, PHP_POKER_TPT_FILE_SIZE);
+		php_poker_tpt_base = NULL;
+		php_poker_tpt = NULL;
+	}
+}
+
+/**
+ * Return the hand rank based on the evaluation value
+ *
+ * @param val Hand evaluation value
+ * @return int Hand rank (1-9, where 1 is best)
+ */
+static int php_poker_hand_rank(unsigned short val)
+{
+	if (val > 6185) return 9; /* High card */
+	if (val > 3325) return 8; /* One pair */
+	if (val > 2467) return 7; /* Two pair */
+	if (val > 1609) return 6; /* Three of a kind */
+	if (val > 1599) return 5; /* Straight */
+	if (val > 322)  return 4; /* Flush */
+	if (val > 166)  return 3; /* Full house */
+	if (val > 10)   return 2; /* Four of a kind */
+
+	return 1;                 /* Straight flush */
+}
+
+/**
+ * Determine the hand rank category from a short-deck hand value
+ *
+ * @param val Short-deck hand value (see php_poker_short_value)
+ * @return int Hand rank (1-9), numbered as in php_poker_hand_rank
+ */
+static int php_poker_short_hand_rank(unsigned short val)
+{
+	if (val > 6185) return 9; /* High card */
+	if (val > 3325) return 8; /* One pair */
+	if (val > 2467) return 7; /* Two pair */
+	if (val > 1609) return 6; /* Three of a kind */
+	if (val > 1599) return 5; /* Straight */
+	if (val > 1443) return 3; /* Full house */
+	if (val > 166)  return 4; /* Flush */
+	if (val > 10)   return 2; /* Four of a kind */
+
+	return 1;                 /* Straight flush */
+}
+
+/**
+ * Get string representation of hand rank
+ *
+ * @param rank Hand rank (1-9)
+ * @return const char* String description of the hand
+ */
+static const char* php_poker_get_hand_name(int rank)
+{
+	switch (rank) {
+		case 1: return "Straight Flush";
+		case 2: return "Four of a Kind";
+		case 3: return "Full House";
+		case 4: return "Flush";
+		case 5: return "Straight";
+		case 6: return "Three of a Kind";
+		case 7: return "Two Pair";
+		case 8: return "One Pair";
+		case 9: return "High Card";
+		default: return "Unknown";
+	}
+}
+
+/**
+ * Evaluate a hand of 5 to 7 cards with the active evaluator
+ *
+ * @param cards Array of card values
+ * @param num_cards Number of cards (5-7)
+ * @return unsigned short Hand value (1 is the best)
+ */
+static inline unsigned short php_poker_eval_cards(int *cards, int num_cards)
+{
+	if (php_poker_tpt) {
+		return php_poker_tpt_eval(cards, num_cards);
+	}
+
+	if (num_cards == 5) {
+		return php_poker_eval_5hand(cards);
+	}
+
+	return num_cards == 6 ? php_poker_eval_6hand(cards) : php_poker_eval_7hand(cards);
+}
+
+/**
+ * Evaluate a batch of hands one at a time
+ *
+ * Reference implementation of the batch kernels, and the fallback on CPUs
+ * without AVX2.
+ *
+ * @param cards Card values, 7 slots per hand
+ * @param num_cards Number of cards per hand (5-7)
+ * @param count Number of hands
+ * @param values Receives the hand values
+ */
+static void php_poker_eval_batch_scalar(const int *cards, const unsigned char *num_cards, size_t count, unsigned short *values)
+{
+	size_t i;
+
+	for (i = 0; i < count; i++) {
+		values[i] = php_poker_eval_cards((int *)&cards[i * 7], num_cards[i]);
+	}
+}
+
+#ifdef PHP_POKER_SIMD
+/**
+ * Gather 16-bit table entries with 32-bit loads (the table needs one entry
+ * of padding)
+ */
+#define PHP_POKER_GATHER16_AVX2(table, index) \
+	_mm256_and_si256(_mm256_i32gather_epi32((const int *)(table), (index), 2), _mm256_set1_epi32(0xFFFF))
+
+/**
+ * Evaluate a batch of hands, 8 at a time with AVX2
+ *
+ * Every lane runs both evaluators: the Cactus Kev 5-card path (flush check,
+ * unique5, prime product and perfect hash) and the direct 6/7-card path
+ * (summed rank keys, suit counter and flush lookup), each skipped when no
+ * lane needs it. Rank keys are only gathered for a hand's own cards, since
+ * rank_keys has 13 entries and the slots past a hand's last card are not
+ * cards. The result is picked per lane, so values are bit-identical
+ * to php_poker_eval_batch_scalar. "plain" masks lanes without a flush.
+ *
+ * @param cards Card values, 7 slots per hand
+ * @param num_cards Number of cards per hand (5-7)
+ * @param count Number of hands
+ * @param values Receives the hand values
+ */
+__attribute__((target("avx2")))
+static void php_poker_eval_batch_avx2(const int *cards, const unsigned char *num_cards, size_t count, unsigned short *values)
+{
+	const __m256i lanes = _mm256_setr_epi32(0, 7, 14, 21, 28, 35, 42, 49);
+	const __m256i low8 = _mm256_set1_epi32(0xFF);
+	const __m256i low4 = _mm256_set1_epi32(0xF);
+	const __m256i zero = _mm256_setzero_si256();
+	__m256i c[7], valid[7], n, is5, is7, direct;
+	__m256i q, plain, value5, u, r, key, suits, suit, ranks, offsets, value;
+	unsigned out[8];
+	size_t i;
+	int k, j;
+
+	for (i = 0; i + 8 <= count; i += 8) {
+		n = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)&num_cards[i]));
+		is5 = _mm256_cmpeq_epi32(n, _mm256_set1_epi32(5));
+		is7 = _mm256_cmpeq_epi32(n, _mm256_set1_epi32(7));
+		direct = _mm256_cmpgt_epi32(n, _mm256_set1_epi32(5));
+
+		for (k = 0; k < 7; k++) {
+			c[k] = _mm256_i32gather_epi32(&cards[i * 7 + k], lanes, 4);
+			valid[k] = _mm256_cmpgt_epi32(n, _mm256_set1_epi32(k));
+		}
+
+		value = zero;
+
+		/* Cactus Kev 5-card path */
+		if (!_mm256_testz_si256(is5, is5)) {
+			q = _mm256_srli_epi32(_mm256_or_si256(_mm256_or_si256(_mm256_or_si256(c[0], c[1]), _mm256_or_si256(c[2], c[3])), c[4]), 16);
+			plain = _mm256_and_si256(_mm256_and_si256(_mm256_and_si256(c[0], c[1]), _mm256_and_si256(c[2], c[3])), c[4]);
+			plain = _mm256_cmpeq_epi32(_mm256_and_si256(plain, _mm256_set1_epi32(0xF000)), zero);
+
+			/* Perfect hash of the prime product (php_poker_find_fast) */
+			u = _mm256_mullo_epi32(_mm256_and_si256(c[0], low8), _mm256_and_si256(c[1], low8));
+			u = _mm256_mullo_epi32(u, _mm256_mullo_epi32(_mm256_and_si256(c[2], low8), _mm256_and_si256(c[3], low8)));
+			u = _mm256_mullo_epi32(u, _mm256_and_si256(c[4], low8));
+			u = _mm256_add_epi32(u, _mm256_set1_epi32((int)0xe91aaa35));
+			u = _mm256_xor_si256(u, _mm256_srli_epi32(u, 16));
+			u = _mm256_add_epi32(u, _mm256_slli_epi32(u, 8));
+			u = _mm256_xor_si256(u, _mm256_srli_epi32(u, 4));
+			r = _mm256_i32gather_epi32((const int *)php_poker_simd_hash_adjust, _mm256_and_si256(_mm256_srli_epi32(u, 8), _mm256_set1_epi32(0x1FF)), 4);
+			r = _mm256_xor_si256(_mm256_srli_epi32(_mm256_add_epi32(u, _mm256_slli_epi32(u, 2)), 19), r);
+			value5 = _mm256_i32gather_epi32((const int *)php_poker_simd_hash_values, r, 4);
+
+			/* Straights and high cards, then flushes */
+			u = _mm256_i32gather_epi32((const int *)php_poker_simd_unique5, q, 4);
+			value5 = _mm256_blendv_epi8(u, value5, _mm256_cmpeq_epi32(u, zero));
+			value5 = _mm256_blendv_epi8(_mm256_i32gather_epi32((const int *)php_poker_simd_flushes, q, 4), value5, plain);
+			value = _mm256_and_si256(value5, is5);
+		}
+
+		/* Direct 6/7-card path */
+		if (!_mm256_testz_si256(direct, direct)) {
+			key = zero;
+			suits = _mm256_set1_epi32(PHP_POKER_SUIT_COUNTER_INIT);
+
+			for (k = 0; k < 7; k++) {
+				key = _mm256_add_epi32(key, _mm256_mask_i32gather_epi32(zero, (const int *)rank_keys, _mm256_and_si256(_mm256_srli_epi32(c[k], 8), low4), valid[k], 4));
+				suits = _mm256_add_epi32(suits, _mm256_and_si256(valid[k], _mm256_i32gather_epi32((const int *)php_poker_suit_adds, _mm256_and_si256(_mm256_srli_epi32(c[k], 12), low4), 4)));
+			}
+
+			/* Suit bit of the flush suit (php_poker_flush_suit) */
+			u = _mm256_and_si256(suits, _mm256_set1_epi32(0x8888));
+			suit = _mm256_or_si256(
+				_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(u, 3), _mm256_set1_epi32(1)), _mm256_and_si256(_mm256_srli_epi32(u, 6), _mm256_set1_epi32(2))),
+				_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(u, 9), _mm256_set1_epi32(4)), _mm256_and_si256(_mm256_srli_epi32(u, 12), _mm256_set1_epi32(8))));
+			suit = _mm256_slli_epi32(suit, 12);
+			plain = _mm256_cmpeq_epi32(suit, zero);
+
+			ranks = zero;
+
+			for (k = 0; k < 7; k++) {
+				u = _mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_and_si256(c[k], suit), zero), valid[k]);
+				ranks = _mm256_or_si256(ranks, _mm256_and_si256(u, _mm256_srli_epi32(c[k], 16)));
+			}
+
+			/* Non-flush hands: one lookup through the row displacement tables */
+			u = _mm256_and_si256(key, _mm256_set1_epi32(PHP_POKER_ROW_MASK));
+			offsets = _mm256_i32gather_epi32((const int *)rank_offsets6, u, 4);
+			offsets = _mm256_mask_i32gather_epi32(offsets, (const int *)rank_offsets7, u, is7, 4);
+			offsets = _mm256_add_epi32(offsets, _mm256_srli_epi32(key, PHP_POKER_ROW_BITS));
+			u = _mm256_mask_i32gather_epi32(zero, (const int *)php_poker_rank_lookup, offsets, _mm256_and_si256(direct, plain), 2);
+			u = _mm256_and_si256(u, _mm256_set1_epi32(0xFFFF));
+			u = _mm256_blendv_epi8(PHP_POKER_GATHER16_AVX2(php_poker_flush_lookup, ranks), u, plain);
+			value = _mm256_blendv_epi8(value, u, direct);
+		}
+
+		_mm256_storeu_si256((__m256i *)out, value);
+
+		for (j = 0; j < 8; j++) {
+			values[i + j] = (unsigned short)out[j];
+		}
+	}
+
+	php_poker_eval_batch_scalar(&cards[i * 7], &num_cards[i], count - i, &values[i]);
+}
+
+/**
+ * Evaluate a batch of hands, 16 at a time with AVX-512
+ *
+ * Same lanes as php_poker_eval_batch_avx2, with mask registers in place of
+ * blends.
+ *
+ * @param cards Card values, 7 slots per hand
+ * @param num_cards Number of cards per hand (5-7)
+ * @param count Number of hands
+ * @param values Receives the hand values
+ */
+__attribute__((target("avx512f")))
+static void php_poker_eval_batch_avx512(const int *cards, const unsigned char *num_cards, size_t count, unsigned short *values)
+{
+	const __m512i lanes = _mm512_setr_epi32(0, 7, 14, 21, 28, 35, 42, 49, 56, 63, 70, 77, 84, 91, 98, 105);
+	const __m512i low8 = _mm512_set1_epi32(0xFF);
+	const __m512i low4 = _mm512_set1_epi32(0xF);
+	const __m512i low16 = _mm512_set1_epi32(0xFFFF);
+	const __m512i zero = _mm512_setzero_si512();
+	__m512i c[7], n, q, value5, u, r, key, suits, suit, ranks, offsets, value;
+	__mmask16 valid[7], is5, is7, direct, flush, nonflush;
+	size_t i;
+	int k;
+
+	for (i = 0; i + 16 <= count; i += 16) {
+		n = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i *)&num_cards[i]));
+		is5 = _mm512_cmpeq_epi32_mask(n, _mm512_set1_epi32(5));
+		is7 = _mm512_cmpeq_epi32_mask(n, _mm512_set1_epi32(7));
+		direct = _mm512_cmpgt_epi32_mask(n, _mm512_set1_epi32(5));
+
+		for (k = 0; k < 7; k++) {
+			c[k] = _mm512_i32gather_epi32(lanes, &cards[i * 7 + k], 4);
+			valid[k] = _mm512_cmpgt_epi32_mask(n, _mm512_set1_epi32(k));
+		}
+
+		value = zero;
+
+		/* Cactus Kev 5-card path */
+		if (is5) {
+			q = _mm512_srli_epi32(_mm512_or_si512(_mm512_or_si512(_mm512_or_si512(c[0], c[1]), _mm512_or_si512(c[2], c[3])), c[4]), 16);
+			u = _mm512_and_si512(_mm512_and_si512(_mm512_and_si512(c[0], c[1]), _mm512_and_si512(c[2], c[3])), c[4]);
+			flush = _mm512_test_epi32_mask(u, _mm512_set1_epi32(0xF000));
+
+			/* Perfect hash of the prime product (php_poker_find_fast) */
+			u = _mm512_mullo_epi32(_mm512_and_si512(c[0], low8), _mm512_and_si512(c[1], low8));
+			u = _mm512_mullo_epi32(u, _mm512_mullo_epi32(_mm512_and_si512(c[2], low8), _mm512_and_si512(c[3], low8)));
+			u = _mm512_mullo_epi32(u, _mm512_and_si512(c[4], low8));
+			u = _mm512_add_epi32(u, _mm512_set1_epi32((int)0xe91aaa35));
+			u = _mm512_xor_si512(u, _mm512_srli_epi32(u, 16));
+			u = _mm512_add_epi32(u, _mm512_slli_epi32(u, 8));
+			u = _mm512_xor_si512(u, _mm512_srli_epi32(u, 4));
+			r = _mm512_i32gather_epi32(_mm512_and_si512(_mm512_srli_epi32(u, 8), _mm512_set1_epi32(0x1FF)), php_poker_simd_hash_adjust, 4);
+			r = _mm512_xor_si512(_mm512_srli_epi32(_mm512_add_epi32(u, _mm512_slli_epi32(u, 2)), 19), r);
+			value5 = _mm512_i32gather_epi32(r, php_poker_simd_hash_values, 4);
+
+			/* Straights and high cards, then flushes */
+			u = _mm512_i32gather_epi32(q, php_poker_simd_unique5, 4);
+			value5 = _mm512_mask_blend_epi32(_mm512_test_epi32_mask(u, u), value5, u);
+			value5 = _mm512_mask_i32gather_epi32(value5, flush, q, php_poker_simd_flushes, 4);
+			value = _mm512_maskz_mov_epi32(is5, value5);
+		}
+
+		/* Direct 6/7-card path */
+		if (direct) {
+			key = zero;
+			suits = _mm512_set1_epi32(PHP_POKER_SUIT_COUNTER_INIT);
+
+			for (k = 0; k < 7; k++) {
+				key = _mm512_add_epi32(key, _mm512_mask_i32gather_epi32(zero, valid[k], _mm512_and_si512(_mm512_srli_epi32(c[k], 8), low4), rank_keys, 4));
+				suits = _mm512_mask_add_epi32(suits, valid[k], suits, _mm512_i32gather_epi32(_mm512_and_si512(_mm512_srli_epi32(c[k], 12), low4), php_poker_suit_adds, 4));
+			}
+
+			/* Suit bit of the flush suit (php_poker_flush_suit) */
+			u = _mm512_and_si512(suits, _mm512_set1_epi32(0x8888));
+			suit = _mm512_or_si512(
+				_mm512_or_si512(_mm512_and_si512(_mm512_srli_epi32(u, 3), _mm512_set1_epi32(1)), _mm512_and_si512(_mm512_srli_epi32(u, 6), _mm512_set1_epi32(2))),
+				_mm512_or_si512(_mm512_and_si512(_mm512_srli_epi32(u, 9), _mm512_set1_epi32(4)), _mm512_and_si512(_mm512_srli_epi32(u, 12), _mm512_set1_epi32(8))));
+			suit = _mm512_slli_epi32(suit, 12);
+			flush = _mm512_test_epi32_mask(suit, suit);
+			nonflush = direct & ~flush;
+
+			ranks = zero;
+
+			for (k = 0; k < 7; k++) {
+				ranks = _mm512_mask_or_epi32(ranks, valid[k] & _mm512_test_epi32_mask(c[k], suit), ranks, _mm512_srli_epi32(c[k], 16));
+			}
+
+			/* Non-flush hands: one lookup through the row displacement tables */
+			u = _mm512_and_si512(key, _mm512_set1_epi32(PHP_POKER_ROW_MASK));
+			offsets = _mm512_i32gather_epi32(u, rank_offsets6, 4);
+			offsets = _mm512_mask_i32gather_epi32(offsets, is7, u, rank_offsets7, 4);
+			offsets = _mm512_add_epi32(offsets, _mm512_srli_epi32(key, PHP_POKER_ROW_BITS));
+			value = _mm512_mask_i32gather_epi32(value, nonflush, offsets, php_poker_rank_lookup, 2);
+			value = _mm512_mask_i32gather_epi32(value, direct & flush, ranks, php_poker_flush_lookup, 2);
+			value = _mm512_and_si512(value, low16);
+		}
+
+		_mm256_storeu_si256((__m256i *)&values[i], _mm512_cvtepi32_epi16(value));
+	}
+
+	php_poker_eval_batch_scalar(&cards[i * 7], &num_cards[i], count - i, &values[i]);
+}
+#endif
+
+/**
+ * Pick the batch evaluation kernel for this CPU
+ *
+ * The vector kernels read widened copies of the Cactus Kev tables, which
+ * are filled here when one of them is selected.
+ */
+static void php_poker_init_eval_batch(void)
+{
+#ifdef PHP_POKER_SIMD
+	size_t i;
+
+	__builtin_cpu_init();
+
+	if (!__builtin_cpu_supports("avx2")) {
+		return;
+	}
+
+	for (i = 0; i < sizeof(flushes) / sizeof(flushes[0]); i++) {
+		php_poker_simd_flushes[i] = flushes[i];
+	}
+
+	for (i = 0; i < sizeof(unique5) / sizeof(unique5[0]); i++) {
+		php_poker_simd_unique5[i] = unique5[i];
+	}
+
+	for (i = 0; i < sizeof(hash_adjust) / sizeof(hash_adjust[0]); i++) {
+		php_poker_simd_hash_adjust[i] = hash_adjust[i];
+	}
+
+	for (i = 0; i < sizeof(hash_values) / sizeof(hash_values[0]); i++) {
+		php_poker_simd_hash_values[i] = hash_values[i];
+	}
+
+	if (__builtin_cpu_supports("avx512f")) {
+		php_poker_eval_batch = php_poker_eval_batch_avx512;
+		php_poker_eval_batch_name = "AVX-512";
+	} else {
+		php_poker_eval_batch = php_poker_eval_batch_avx2;
+		php_poker_eval_batch_name = "AVX2";
+	}
+#endif
+}
+
+/**
+ * Pick a seed for a call that did not ask for one
+ *
+ * @return uint64_t Seed from the system CSPRNG, or from the clock if that fails
+ */
+static uint64_t php_poker_random_seed(void)
+{
+	uint64_t seed;
+
+	if (php_random_bytes_silent(&seed, sizeof(seed)) == FAILURE) {
+		seed = ((uint64_t)time(NULL) << 32) ^ (uint64_t)getpid() ^ (uint64_t)(uintptr_t)&seed;
+	}
+
+	return seed;
+}
+
+/**
+ * Read the monotonic clock
+ *
+ * @return uint64_t Nanoseconds since an arbitrary starting point
+ */
+static inline uint64_t php_poker_clock(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * Start the random stream of one Monte Carlo chunk
+ *
+ * Every chunk of a call gets its own stream derived from the call's seed and
+ * the chunk number, so results do not depend on which thread runs a chunk.
+ * The xoshiro256** state is expanded from both with splitmix64.
+ *
+ * @param rng Stream to initialize
+ * @param seed Seed of the call
+ * @param chunk Chunk number
+ */
+static void php_poker_rng_seed(php_poker_rng *rng, uint64_t seed, uint64_t chunk)
+{
+	uint64_t x = seed ^ (chunk * 0xD1B54A32D192ED03ULL);
+	uint64_t z;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		z = (x += 0x9E3779B97F4A7C15ULL);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		rng->s[i] = z ^ (z >> 31);
+	}
+}
+
+/**
+ * Next 64 random bits of a stream (xoshiro256**)
+ *
+ * @param rng Random stream
+ * @return uint64_t Random value
+ */
+static inline uint64_t php_poker_rng_next(php_poker_rng *rng)
+{
+	uint64_t *s = rng->s;
+	uint64_t result = s[1] * 5;
+	uint64_t t = s[1] << 17;
+
+	result = ((result << 7) | (result >> 57)) * 9;
+
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = (s[3] << 45) | (s[3] >> 19);
+
+	return result;
+}
+
+/**
+ * Generate a random number between 0 and limit-1, without modulo bias
+ *
+ * Multiplies 32 random bits by the limit and keeps the high half, rejecting
+ * the few low halves that would make some results more likely (Lemire).
+ *
+ * @param rng Random stream
+ * @param limit Upper bound (exclusive)
+ * @return int Random number
+ */
+static inline int php_poker_rand_int(php_poker_rng *rng, int limit)
+{
+	uint32_t range = (uint32_t)limit;
+	uint64_t m = (php_poker_rng_next(rng) >> 32) * range;
+	uint32_t threshold;
+
+	if ((uint32_t)m < range) {
+		threshold = -range % range;
+
+		while ((uint32_t)m < threshold) {
+			m = (php_poker_rng_next(rng) >> 32) * range;
+		}
+	}
+
+	return (int)(m >> 32);
+}
+
+/**
+ * Deal cards from the top of a deck at random
+ *
+ * A partial Fisher-Yates shuffle: only the first num_deal positions are
+ * drawn, which is all a board runout needs. The rest of the deck stays a
+ * permutation of the remaining cards, so it can be dealt from again.
+ *
+ * @param rng Random stream
+ * @param deck Array of cards
+ * @param num_cards Number of cards in the deck
+ * @param num_deal Number of cards to deal to the front of the deck
+ */
+static inline void php_poker_deal_cards(php_poker_rng *rng, int *deck, int num_cards, int num_deal)
+{
+	int i, j, temp;
+
+	for (i = 0; i < num_deal; i++) {
+		j = i + php_poker_rand_int(rng, num_cards - i);
+		temp = deck[j];
+		deck[j] = deck[i];
+		deck[i] = temp;
+	}
+}
+
+/**
+ * Deal cards from the top of a deck at random, skipping excluded cards
+ *
+ * Like php_poker_deal_cards, but a drawn card that is in the excluded mask
+ * (e.g. dealt to a range player this iteration) is drawn again.
+ *
+ * @param rng Random stream
+ * @param deck Array of cards
+ * @param num_cards Number of cards in the deck
+ * @param num_deal Number of cards to deal to the front of the deck
+ * @param excluded Mask of cards that must not be dealt
+ */
+static inline void php_poker_deal_cards_excluding(php_poker_rng *rng, int *deck, int num_cards, int num_deal, uint64_t excluded)
+{
+	int i, j, temp;
+
+	for (i = 0; i < num_deal; i++) {
+		do {
+			j = i + php_poker_rand_int(rng, num_cards - i);
+		} while (excluded & php_poker_card_bit(deck[j]));
+
+		temp = deck[j];
+		deck[j] = deck[i];
+		deck[i] = temp;
+	}
+}
+
+/**
+ * Remove cards from the deck that are already in play
+ *
+ * @param deck Array to store the prepared deck
+ * @param used Mask of the cards already in play
+ * @return int Number of cards in the prepared deck
+ */
+static int php_poker_prepare_deck(int *deck, uint64_t used)
+{
+	uint64_t remaining = ~used & PHP_POKER_DECK_MASK;
+	int count = 0;
+
+	/* Cards in id order: clubs, diamonds, hearts, spades, deuce to ace */
+	while (remaining) {
+		deck[count++] = php_poker_card_from_id(__builtin_ctzll(remaining));
+		remaining &= remaining - 1;
+	}
+
+	return count;
+}
+
+/**
+ * Number of ways to choose k items out of n
+ *
+ * @param n Number of items
+ * @param k Number to choose
+ * @return zend_long Binomial coefficient
+ */
+static zend_long php_poker_choose(int n, int k)
+{
+	zend_long result = 1;
+	int i;
+
+	if (k < 0 || k > n) {
+		return 0;
+	}
+
+	for (i = 1; i <= k; i++) {
+		result = result * (n - k + i) / i;
+	}
+
+	return result;
+}
+
+/**
+ * Score one complete board for every player and credit the winner(s)
+ *
+ * @param eq Equity state, with all five board cards filled in
+ * @param weight Number of boards this one stands for
+ */
+static void php_poker_showdown(php_poker_equity *eq, zend_long weight)
+{
+	unsigned short scores[10];
+	unsigned short best_score = 9999;
+	int winners = 0;
+	int winner_indices[10] = {0};
+	int lows[10];
+	int board_low = 0;
+	php_poker_board_state board;
+	php_poker_omaha_board omaha_board;
+	int j;
+
+	/* Evaluate each player's hand */
+	if (eq->game == PHP_POKER_GAME_OMAHA || eq->game == PHP_POKER_GAME_OMAHA5) {
+		/* The board subsets are combined once, then each player adds hole card pairs */
+		php_poker_init_omaha_board(&omaha_board, eq->board, 5);
+
+		for (j = 0; j < eq->num_players; j++) {
+			scores[j] = php_poker_eval_omaha_hand(&omaha_board, eq->player_hands[j], php_poker_game_hole_cards[eq->game]);
+
+			if (eq->hilo) {
+				lows[j] = php_poker_eval_omaha_low(&omaha_board, eq->player_hands[j], php_poker_game_hole_cards[eq->game]);
+			}
+		}
+	} else if (php_poker_tpt && eq->game == PHP_POKER_GAME_HOLDEM) {
+		/* One table load per dealt card */
+		for (j = 0; j < eq->num_players; j++) {
+			scores[j] = (unsigned short)php_poker_tpt_walk(eq->tpt_states[j], &eq->board[eq->board_count], 5 - eq->board_count);
+		}
+	} else {
+		/* The board is summarized once, then each player adds two cards */
+		php_poker_init_board_state(&board, eq->board, 5, eq->game);
+
+		for (j = 0; j < eq->num_players; j++) {
+			scores[j] = php_poker_eval_board_hand(&board, eq->player_hands[j][0], eq->player_hands[j][1]);
+		}
+	}
+
+	if (eq->categories) {
+		php_poker_count_categories(eq, scores, weight);
+	}
+
+	/* Hold'em lows may use any five of the seven cards */
+	if (eq->hilo && eq->game == PHP_POKER_GAME_HOLDEM) {
+		for (j = 0; j < 5; j++) {
+			board_low |= php_poker_low_bits(eq->board[j] >> 16);
+		}
+
+		for (j = 0; j < eq->num_players; j++) {
+			lows[j] = php_poker_low_lookup[board_low | php_poker_low_bits((eq->player_hands[j][0] | eq->player_hands[j][1]) >> 16)];
+		}
+	}
+
+	if (eq->hilo) {
+		php_poker_split_pot(eq, scores, lows, weight);
+		return;
+	}
+
+	/* Find the best score (lowest value is best) */
+	for (j = 0; j < eq->num_players; j++) {
+		if (scores[j] < best_score) {
+			best_score = scores[j];
+			winners = 1;
+			winner_indices[0] = j;
+		} else if (scores[j] == best_score) {
+			winner_indices[winners++] = j;
+		}
+	}
+
+	/* Update win/tie counters */
+	if (winners == 1) {
+		eq->wins[winner_indices[0]] += weight;
+	} else {
+		/* It's a tie between multiple players */
+		for (j = 0; j < winners; j++) {
+			eq->ties[winner_indices[j]] += weight;
+		}
+	}
+
+	/* Credit the combos dealt from hand ranges */
+	if (eq->combo_stats) {
+		for (j = 0; j < winners; j++) {
+			if (eq->ranges[winner_indices[j]]) {
+				eq->combo_stats[eq->ranges[winner_indices[j]]->first + eq->combos[winner_indices[j]]][winners == 1 ? 0 : 1] += weight;
+			}
+		}
+	}
+}
+
+/**
+ * Count each player's final hand category, and the categories of the best
+ * high hands
+ *
+ * @param eq Equity state
+ * @param scores High hand value of each player (lower is better)
+ * @param weight Number of boards this one stands for
+ */
+static void php_poker_count_categories(php_poker_equity *eq, const unsigned short *scores, zend_long weight)
+{
+	unsigned short best_score = 9999;
+	int j, rank;
+
+	for (j = 0; j < eq->num_players; j++) {
+		if (scores[j] < best_score) {
+			best_score = scores[j];
+		}
+	}
+
+	for (j = 0; j < eq->num_players; j++) {
+		rank = eq->game == PHP_POKER_GAME_SHORTDECK ? php_poker_short_hand_rank(scores[j]) : php_poker_hand_rank(scores[j]);
+		eq->hand_counts[j][rank - 1] += weight;
+
+		if (scores[j] == best_score) {
+			eq->win_counts[j][rank - 1] += weight;
+		}
+	}
+}
+
+/**
+ * Split a hi-lo pot and credit each player's share
+ *
+ * Half the pot goes to the best high hand and half to the best low; with no
+ * qualifying low the high hand takes it all. Tied players split their half.
+ * wins and ties count the high hand alone, shares the pot actually won.
+ * Every board with a share counts in exactly one of scoops, high_only,
+ * low_only and partial_scoops.
+ *
+ * @param eq Equity state
+ * @param scores High hand value of each player (lower is better)
+ * @param lows Low value of each player (lower is better, 0 for no low)
+ * @param weight Number of boards this one stands for
+ */
+static void php_poker_split_pot(php_poker_equity *eq, const unsigned short *scores, const int *lows, zend_long weight)
+{
+	unsigned short best_score = 9999;
+	int best_low = 0;
+	int high_winners = 0, low_winners = 0;
+	zend_long high_share, low_share, share;
+	int j, high, low;
+
+	for (j = 0; j < eq->num_players; j++) {
+		if (scores[j] < best_score) {
+			best_score = scores[j];
+			high_winners = 0;
+		}
+
+		high_winners += scores[j] == best_score;
+
+		if (lows[j] && (!best_low || lows[j] < best_low)) {
+			best_low = lows[j];
+			low_winners = 0;
+		}
+
+		low_winners += lows[j] && lows[j] == best_low;
+	}
+
+	high_share = best_low ? PHP_POKER_POT_UNITS / 2 / high_winners : PHP_POKER_POT_UNITS / high_winners;
+	low_share = best_low ? PHP_POKER_POT_UNITS / 2 / low_winners : 0;
+
+	for (j = 0; j < eq->num_players; j++) {
+		high = scores[j] == best_score;
+		low = best_low && lows[j] == best_low;
+		share = (high ? high_share : 0) + (low ? low_share : 0);
+
+		if (!share) {
+			continue;
+		}
+
+		if (high) {
+			if (high_winners == 1) {
+				eq->wins[j] += weight;
+			} else {
+				eq->ties[j] += weight;
+			}
+		}
+
+		eq->shares[j] += share * weight;
+		eq->share_squares[j] += share * share * weight;
+
+		if (share == PHP_POKER_POT_UNITS) {
+			eq->scoops[j] += weight;
+		} else if (!low) {
+			eq->high_only[j] += weight;
+		} else if (!high) {
+			eq->low_only[j] += weight;
+		} else {
+			eq->partial_scoops[j] += weight;
+		}
+
+		/* Range combos are credited with the pot units they won */
+		if (eq->combo_stats && eq->ranges[j]) {
+			eq->combo_stats[eq->ranges[j]->first + eq->combos[j]][0] += share * weight;
+		}
+	}
+}
+
+/**
+ * Group the suits that are interchangeable for the current deal
+ *
+ * Two suits are interchangeable when swapping them maps every player's hole
+ * cards, the board and the dead cards onto themselves, i.e. when each of
+ * those sets holds the same ranks in both suits.
+ *
+ * @param classes Receives the suit classes
+ * @param eq Equity state with hole cards and board
+ * @param dead_cards Array of dead cards
+ * @param dead_count Number of dead cards
+ */
+static void php_poker_init_suit_classes(php_poker_suit_classes *classes, php_poker_equity *eq, int *dead_cards, int dead_count)
+{
+	int signature[4][12] = {{0}};
+	int s, c, j, k;
+
+	for (j = 0; j < eq->num_players; j++) {
+		for (k = 0; k < php_poker_game_hole_cards[eq->game]; k++) {
+			signature[php_poker_suit_index(eq->player_hands[j][k])][j] |= eq->player_hands[j][k] >> 16;
+		}
+	}
+
+	for (k = 0; k < eq->board_count; k++) {
+		signature[php_poker_suit_index(eq->board[k])][10] |= eq->board[k] >> 16;
+	}
+
+	for (k = 0; k < dead_count; k++) {
+		signature[php_poker_suit_index(dead_cards[k])][11] |= dead_cards[k] >> 16;
+	}
+
+	classes->count = 0;
+
+	for (s = 0; s < 4; s++) {
+		for (c = 0; c < classes->count; c++) {
+			if (memcmp(signature[s], signature[classes->suits[c][0]], sizeof(signature[s])) == 0) {
+				break;
+			}
+		}
+
+		if (c == classes->count) {
+			classes->size[classes->count++] = 0;
+		}
+
+		classes->suits[c][classes->size[c]++] = s;
+	}
+}
+
+/**
+ * Enumerate the remaining boards rank by rank, one suit class at a time
+ *
+ * At each rank, taking j cards out of a class of m interchangeable suits
+ * gives C(m, j) boards that all score the same, so only the first j suits
+ * of the class are dealt and the board is weighted by C(m, j). The class is
+ * then split into the suits that were dealt and those that were not, since
+ * they are no longer interchangeable for the ranks that follow.
+ *
+ * @param ex Enumeration state
+ * @param rank Rank being dealt (0-12)
+ * @param cls Index of the next class of the current rank
+ * @param remaining Number of board cards still to deal
+ * @param weight Number of boards the current partial board stands for
+ * @param in Suit classes at the start of this rank
+ * @param out Suit classes being built for the next rank
+ */
+static void php_poker_exact_rank(php_poker_exact *ex, int rank, int cls, int remaining, zend_long weight, const php_poker_suit_classes *in, const php_poker_suit_classes *out)
+{
+	php_poker_suit_classes next;
+	int j, k, size, max_take, position;
+
+	if (remaining == 0) {
+		php_poker_showdown(ex->equity, weight);
+		ex->evaluated++;
+		return;
+	}
+
+	if (rank == 13) {
+		return;
+	}
+
+	if (cls == in->count) {
+		next.count = 0;
+		php_poker_exact_rank(ex, rank + 1, 0, remaining, weight, out, &next);
+		return;
+	}
+
+	size = in->size[cls];
+	max_take = ex->available[rank][in->suits[cls][0]] ? (size < remaining ? size : remaining) : 0;
+	position = 5 - remaining;
+
+	for (j = 0; j <= max_take; j++) {
+		next = *out;
+
+		for (k = 0; k < j; k++) {
+			ex->equity->board[position + k] = php_poker_make_card(rank, in->suits[cls][k]);
+		}
+
+		if (j > 0) {
+			next.size[next.count] = j;
+			memcpy(next.suits[next.count++], in->suits[cls], sizeof(int) * j);
+		}
+
+		if (j < size) {
+			next.size[next.count] = size - j;
+			memcpy(next.suits[next.count++], &in->suits[cls][j], sizeof(int) * (size - j));
+		}
+
+		php_poker_exact_rank(ex, rank, cls + 1, remaining - j, weight * php_poker_choose(size, j), in, &next);
+	}
+}
+
+/**
+ * Enumerate every remaining board exactly, up to suit isomorphism
+ *
+ * @param eq Equity state (wins/ties are credited per board)
+ * @param deck Array of cards left in the deck
+ * @param num_cards Number of cards left in the deck
+ * @param dead_cards Array of dead cards
+ * @param dead_count Number of dead cards
+ * @return int Number of distinct boards that were evaluated
+ */
+static int php_poker_enumerate_boards(php_poker_equity *eq, int *deck, int num_cards, int *dead_cards, int dead_count)
+{
+	php_poker_exact ex;
+	php_poker_suit_classes classes, next;
+	int i;
+
+	memset(&ex, 0, sizeof(ex));
+	ex.equity = eq;
+
+	for (i = 0; i < num_cards; i++) {
+		ex.available[RANK(deck[i])][php_poker_suit_index(deck[i])] = 1;
+	}
+
+	php_poker_init_suit_classes(&classes, eq, dead_cards, dead_count);
+	next.count = 0;
+
+	php_poker_exact_rank(&ex, 0, 0, 5 - eq->board_count, 1, &classes, &next);
+
+	return ex.evaluated;
+}
+
+/**
+ * Read a game name option
+ *
+ * @param zv "holdem", "omaha", "omaha5" or "shortdeck"
+ * @return int PHP_POKER_GAME_*, or -1 if the name is not known
+ */
+static int php_poker_parse_game(zval *zv)
+{
+	if (Z_TYPE_P(zv) != IS_STRING) {
+		return -1;
+	}
+
+	if (strcmp(Z_STRVAL_P(zv), "holdem") == 0) {
+		return PHP_POKER_GAME_HOLDEM;
+	} else if (strcmp(Z_STRVAL_P(zv), "omaha") == 0) {
+		return PHP_POKER_GAME_OMAHA;
+	} else if (strcmp(Z_STRVAL_P(zv), "omaha5") == 0) {
+		return PHP_POKER_GAME_OMAHA5;
+	} else if (strcmp(Z_STRVAL_P(zv), "shortdeck") == 0) {
+		return PHP_POKER_GAME_SHORTDECK;
+	}
+
+	return -1;
+}
+
+/**
+ * Score every player's hand on a board of 3 to 5 cards
+ *
+ * @param eq Equity state with the players' hole cards and the game
+ * @param board Board cards
+ * @param board_count Number of board cards (3-5)
+ * @param scores Receives each player's hand value (lower is better)
+ */
+static void php_poker_score_hands(const php_poker_equity *eq, const int *board, int board_count, unsigned short *scores)
+{
+	php_poker_board_state state;
+	php_poker_omaha_board omaha_board;
+	int cards[5];
+	int j;
+
+	if (eq->game == PHP_POKER_GAME_OMAHA || eq->game == PHP_POKER_GAME_OMAHA5) {
+		php_poker_init_omaha_board(&omaha_board, board, board_count);
+
+		for (j = 0; j < eq->num_players; j++) {
+			scores[j] = php_poker_eval_omaha_hand(&omaha_board, eq->player_hands[j], php_poker_game_hole_cards[eq->game]);
+		}
+	} else if (board_count == 3) {
+		memcpy(&cards[2], board, sizeof(int) * 3);
+
+		for (j = 0; j < eq->num_players; j++) {
+			cards[0] = eq->player_hands[j][0];
+			cards[1] = eq->player_hands[j][1];
+			scores[j] = eq->game == PHP_POKER_GAME_SHORTDECK ? php_poker_eval_short_cards(cards, 5) : php_poker_eval_5hand(cards);
+		}
+	} else {
+		php_poker_init_board_state(&state, board, board_count, eq->game);
+
+		for (j = 0; j < eq->num_players; j++) {
+			scores[j] = php_poker_eval_board_hand(&state, eq->player_hands[j][0], eq->player_hands[j][1]);
+		}
+	}
+}
+
+/**
+ * Best hand value among the players
+ *
+ * @param scores Hand value of each player (lower is better)
+ * @param num_players Number of players
+ * @param winners Receives the number of players holding it
+ * @return unsigned short Best hand value
+ */
+static unsigned short php_poker_best_score(const unsigned short *scores, int num_players, int *winners)
+{
+	unsigned short best_score = 9999;
+	int j;
+
+	*winners = 0;
+
+	for (j = 0; j < num_players; j++) {
+		if (scores[j] < best_score) {
+			best_score = scores[j];
+			*winners = 0;
+		}
+
+		*winners += scores[j] == best_score;
+	}
+
+	return best_score;
+}
+
+/**
+ * Break a flop or turn spot down by the next card
+ *
+ * On the turn each next card is the river and settles the pot. On the flop
+ * every turn and river pair makes one final board, which is scored once and
+ * credited to the rows of both of its cards, so each row ends up holding
+ * all the rivers that can follow its turn card.
+ *
+ * A card is an out for the player it puts ahead of everyone else, unless
+ * that player was already ahead alone before it.
+ *
+ * @param eq Equity state with the players' hole cards and the 3 or 4 card board
+ * @param deck Cards that can come next
+ * @param num_cards Number of cards in deck
+ * @param shares Receives each row's pot won per player, in PHP_POKER_POT_UNITS per board, or NULL
+ * @param wins Receives each row's boards won alone per player, or NULL
+ * @param ties Receives each row's boards tied per player, or NULL
+ * @param outs Receives each player's outs as a card mask, or NULL
+ */
+static void php_poker_runouts(const php_poker_equity *eq, const int *deck, int num_cards, zend_long (*shares)[10], zend_long (*wins)[10], zend_long (*ties)[10], uint64_t *outs)
+{
+	unsigned short scores[10], best_score;
+	int board[5];
+	int count = eq->board_count;
+	int leader = -1;
+	int c, r, j, winners;
+
+	memcpy(board, eq->board, sizeof(int) * count);
+
+	if (shares) {
+		memset(shares, 0, sizeof(*shares) * num_cards);
+	}
+
+	if (wins) {
+		memset(wins, 0, sizeof(*wins) * num_cards);
+		memset(ties, 0, sizeof(*ties) * num_cards);
+	}
+
+	/* Who is ahead alone before the next card */
+	if (outs) {
+		memset(outs, 0, sizeof(uint64_t) * eq->num_players);
+		php_poker_score_hands(eq, board, count, scores);
+		best_score = php_poker_best_score(scores, eq->num_players, &winners);
+
+		for (j = 0; j < eq->num_players && winners == 1; j++) {
+			if (scores[j] == best_score) {
+				leader = j;
+			}
+		}
+	}
+
+	for (c = 0; c < num_cards; c++) {
+		board[count] = deck[c];
+
+		/* On the flop the turn card alone only matters for the outs */
+		if (count == 4 || outs) {
+			php_poker_score_hands(eq, board, count + 1, scores);
+			best_score = php_poker_best_score(scores, eq->num_players, &winners);
+
+			for (j = 0; j < eq->num_players; j++) {
+				if (scores[j] != best_score) {
+					continue;
+				}
+
+				if (outs && winners == 1 && j != leader) {
+					outs[j] |= php_poker_card_bit(deck[c]);
+				}
+
+				/* The river decides it */
+				if (count == 4 && shares) {
+					shares[c][j] += PHP_POKER_POT_UNITS / winners;
+				}
+
+				if (count == 4 && wins) {
+					(winners == 1 ? wins : ties)[c][j]++;
+				}
+			}
+		}
+
+		if (count == 4) {
+			continue;
+		}
+
+		for (r = c + 1; r < num_cards; r++) {
+			board[4] = deck[r];
+			php_poker_score_hands(eq, board, 5, scores);
+			best_score = php_poker_best_score(scores, eq->num_players, &winners);
+
+			for (j = 0; j < eq->num_players; j++) {
+				if (scores[j] != best_score) {
+					continue;
+				}
+
+				if (shares) {
+					shares[c][j] += PHP_POKER_POT_UNITS / winners;
+					shares[r][j] += PHP_POKER_POT_UNITS / winners;
+				}
+
+				if (wins) {
+					(winners == 1 ? wins : ties)[c][j]++;
+					(winners == 1 ? wins : ties)[r][j]++;
+				}
+			}
+		}
+	}
+}
+
+/**
+ * Index of a card in a 52-card mask (suit index * 13 + rank)
+ *
+ * @param card Card value
+ * @return int Card index (0-51)
+ */
+static inline int php_poker_card_index(int card)
+{
+	return php_poker_suit_index(card) * 13 + RANK(card);
+}
+
+/**
+ * Bit of a card in a 52-card mask
+ *
+ * @param card Card value
+ * @return uint64_t Card bit
+ */
+static inline uint64_t php_poker_card_bit(int card)
+{
+	return 1ULL << php_poker_card_index(card);
+}
+
+/**
+ * Index of a two-card combo (0-1325)
+ *
+ * @param index1 Card index of one card
+ * @param index2 Card index of the other card
+ * @return int Combo index
+ */
+static inline int php_poker_combo_index(int index1, int index2)
+{
+	if (index1 > index2) {
+		return index1 * (index1 - 1) / 2 + index2;
+	}
+
+	return index2 * (index2 - 1) / 2 + index1;
+}
+
+/**
+ * Write the name of a combo, higher rank first (e.g. "AhKd")
+ *
+ * @param name Buffer of at least 5 characters
+ * @param card1 First card
+ * @param card2 Second card
+ */
+static void php_poker_combo_name(char *name, int card1, int card2)
+{
+	static const char ranks[] = "23456789TJQKA";
+	static const char suits[] = "cdhs";
+	int temp;
+
+	if (RANK(card2) > RANK(card1) || (RANK(card2) == RANK(card1) && php_poker_suit_index(card2) > php_poker_suit_index(card1))) {
+		temp = card1;
+		card1 = card2;
+		card2 = temp;
+	}
+
+	name[0] = ranks[RANK(card1)];
+	name[1] = suits[php_poker_suit_index(card1)];
+	name[2] = ranks[RANK(card2)];
+	name[3] = suits[php_poker_suit_index(card2)];
+	name[4] = '\0';
+}
+
+/**
+ * Set the weight of every combo of a starting hand class (e.g. AKs, QQ)
+ *
+ * @param weights Weight per combo index
+ * @param high Higher rank (0-12)
+ * @param low Lower rank (0-12), equal to high for pairs
+ * @param suitedness PHP_POKER_SUITED, PHP_POKER_OFFSUIT or both
+ * @param weight Weight to set
+ */
+static void php_poker_range_add_class(double *weights, int high, int low, int suitedness, double weight)
+{
+	int s1, s2;
+
+	for (s1 = 0; s1 < 4; s1++) {
+		for (s2 = 0; s2 < 4; s2++) {
+			if (high == low ? s2 <= s1 : !(suitedness & (s1 == s2 ? PHP_POKER_SUITED : PHP_POKER_OFFSUIT))) {
+				continue;
+			}
+
+			weights[php_poker_combo_index(s1 * 13 + high, s2 * 13 + low)] = weight;
+		}
+	}
+}
+
+/**
+ * Parse a starting hand class such as "AK", "AKs", "T9o" or "77"
+ *
+ * @param str Class text (at least 2 characters are read)
+ * @param high Receives the higher rank
+ * @param low Receives the lower rank
+ * @param suitedness Receives PHP_POKER_SUITED, PHP_POKER_OFFSUIT or both
+ * @return int Number of characters used, or -1 if invalid
+ */
+static int php_poker_parse_range_class(const char *str, int *high, int *low, int *suitedness)
+{
+	int rank1 = php_poker_char_to_rank(str[0]);
+	int rank2 = rank1 < 0 ? -1 : php_poker_char_to_rank(str[1]);
+
+	if (rank1 < 0 || rank2 < 0) {
+		return -1;
+	}
+
+	*high = rank1 > rank2 ? rank1 : rank2;
+	*low = rank1 > rank2 ? rank2 : rank1;
+	*suitedness = PHP_POKER_SUITED | PHP_POKER_OFFSUIT;
+
+	if (str[2] == 's' || str[2] == 'S' || str[2] == 'o' || str[2] == 'O') {
+		if (rank1 == rank2) {
+			return -1;
+		}
+
+		*suitedness = (str[2] == 's' || str[2] == 'S') ? PHP_POKER_SUITED : PHP_POKER_OFFSUIT;
+		return 3;
+	}
+
+	return 2;
+}
+
+/**
+ * Parse one comma-separated part of a hand range
+ *
+ * Accepted forms, each optionally followed by ":weight":
+ *   AhKh        one combo
+ *   QQ, AKs     a starting hand class (AK alone means suited and offsuit)
+ *   QQ+, A2s+   pairs up to aces, or kickers up to one below the top card
+ *   99-66       pairs between two ranks
+ *   A5s-A2s     kickers between two ranks below the same top card
+ *   T9s-76s     classes with the same gap, stepping both ranks down
+ *
+ * @param token Part of the range, without surrounding spaces
+ * @param weights Weight per combo index, updated in place
+ * @return int SUCCESS or FAILURE
+ */
+static int php_poker_parse_range_token(const char *token, double *weights)
+{
+	int cards[3];
+	int high, low, suitedness, high2, low2, suitedness2, used, used2, i;
+	double weight = 1.0;
+	char text[32];
+	char *colon, *end;
+
+	if (strlen(token) >= sizeof(text)) {
+		return FAILURE;
+	}
+
+	strcpy(text, token);
+
+	if ((colon = strchr(text, ':')) != NULL) {
+		weight = strtod(colon + 1, &end);
+
+		if (end == colon + 1 || *end != '\0' || !(weight >= 0.0) || weight > 1.0) {
+			return FAILURE;
+		}
+
+		/* Drop the weight and any spaces before it */
+		do {
+			*colon-- = '\0';
+		} while (colon >= text && (*colon == ' ' || *colon == '\t'));
+	}
+
+	/* One specific combo. The card parser stops before a lone trailing
+	 * character, so "AsKs+" must be caught here.
+	 */
+	if (php_poker_parse_hand(text, cards, 3) == 2) {
+		for (i = 0, used = 0; text[i] != '\0'; i++) {
+			used += text[i] != ' ' && text[i] != '\t';
+		}
+
+		if (cards[0] == cards[1] || used != 4) {
+			return FAILURE;
+		}
+
+		weights[php_poker_combo_index(php_poker_card_index(cards[0]), php_poker_card_index(cards[1]))] = weight;
+		return SUCCESS;
+	}
+
+	if ((used = php_poker_parse_range_class(text, &high, &low, &suitedness)) < 0) {
+		return FAILURE;
+	}
+
+	if (text[used] == '\0') {
+		php_poker_range_add_class(weights, high, low, suitedness, weight);
+		return SUCCESS;
+	}
+
+	if (text[used] == '+' && text[used + 1] == '\0') {
+		if (high == low) {
+			for (i = high; i < 13; i++) {
+				php_poker_range_add_class(weights, i, i, suitedness, weight);
+			}
+		} else {
+			for (i = low; i < high; i++) {
+				php_poker_range_add_class(weights, high, i, suitedness, weight);
+			}
+		}
+
+		return SUCCESS;
+	}
+
+	if (text[used] != '-'
+		|| (used2 = php_poker_parse_range_class(&text[used + 1], &high2, &low2, &suitedness2)) < 0
+		|| text[used + 1 + used2] != '\0'
+		|| suitedness2 != suitedness
+		|| (high == low) != (high2 == low2)) {
+		return FAILURE;
+	}
+
+	if (high == low) {
+		for (i = (low < low2 ? low : low2); i <= (low < low2 ? low2 : low); i++) {
+			php_poker_range_add_class(weights, i, i, suitedness, weight);
+		}
+	} else if (high == high2) {
+		for (i = (low < low2 ? low : low2); i <= (low < low2 ? low2 : low); i++) {
+			php_poker_range_add_class(weights, high, i, suitedness, weight);
+		}
+	} else if (high - low == high2 - low2) {
+		for (i = (high < high2 ? high : high2); i <= (high < high2 ? high2 : high); i++) {
+			php_poker_range_add_class(weights, i, i - (high - low), suitedness, weight);
+		}
+	} else {
+		return FAILURE;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * Parse a hand range such as "QQ+, AKs, T9s-76s, AhKh:0.5"
+ *
+ * @param range_str Range text, parts separated by commas
+ * @param weights Weight per combo index; combos not named are set to 0
+ * @return int SUCCESS or FAILURE
+ */
+static int php_poker_parse_range(const char *range_str, double *weights)
+{
+	char token[32];
+	const char *start, *end;
+	size_t length;
+
+	memset(weights, 0, sizeof(double) * PHP_POKER_COMBOS);
+
+	for (start = range_str; *start; start = *end ? end + 1 : end) {
+		end = strchr(start, ',');
+
+		if (!end) {
+			end = start + strlen(start);
+		}
+
+		/* Trim spaces */
+		while (start < end && (*start == ' ' || *start == '\t')) {
+			start++;
+		}
+
+		length = end - start;
+
+		while (length > 0 && (start[length - 1] == ' ' || start[length - 1] == '\t')) {
+			length--;
+		}
+
+		if (length == 0 || length >= sizeof(token)) {
+			return FAILURE;
+		}
+
+		memcpy(token, start, length);
+		token[length] = '\0';
+
+		if (php_poker_parse_range_token(token, weights) == FAILURE) {
+			return FAILURE;
+		}
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * Collect the combos of a range that do not use excluded cards
+ *
+ * Also builds the Walker alias table, so a combo can be drawn in proportion
+ * to its weight with one bounded draw and one comparison.
+ *
+ * @param range Receives the combos and alias table
+ * @param weights Weight per combo index
+ * @param excluded Mask of cards already in play (board, dead and fixed hole cards)
+ * @return int Number of combos left
+ */
+static int php_poker_build_range(php_poker_range *range, const double *weights, uint64_t excluded)
+{
+	int small[PHP_POKER_COMBOS], large[PHP_POKER_COMBOS];
+	int num_small = 0, num_large = 0;
+	int index1, index2, combo, s, l;
+	uint64_t mask;
+	double total = 0.0;
+
+	range->count = 0;
+
+	for (index2 = 1; index2 < 52; index2++) {
+		for (index1 = 0; index1 < index2; index1++) {
+			combo = php_poker_combo_index(index1, index2);
+			mask = (1ULL << index1) | (1ULL << index2);
+
+			if (weights[combo] <= 0.0 || (mask & excluded)) {
+				continue;
+			}
+
+			range->cards[range->count][0] = php_poker_make_card(index2 % 13, index2 / 13);
+			range->cards[range->count][1] = php_poker_make_card(index1 % 13, index1 / 13);
+			range->masks[range->count] = mask;
+			range->combos[range->count] = (short)combo;
+			range->prob[range->count] = weights[combo];
+			total += weights[combo];
+			range->count++;
+		}
+	}
+
+	if (range->count == 0) {
+		return 0;
+	}
+
+	/* Vose's alias method */
+	for (combo = 0; combo < range->count; combo++) {
+		range->prob[combo] *= range->count / total;
+		range->alias[combo] = combo;
+
+		if (range->prob[combo] < 1.0) {
+			small[num_small++] = combo;
+		} else {
+			large[num_large++] = combo;
+		}
+	}
+
+	while (num_small > 0 && num_large > 0) {
+		s = small[--num_small];
+		l = large[--num_large];
+
+		range->alias[s] = l;
+		range->prob[l] -= 1.0 - range->prob[s];
+
+		if (range->prob[l] < 1.0) {
+			small[num_small++] = l;
+		} else {
+			large[num_large++] = l;
+		}
+	}
+
+	/* Whatever is left is 1 up to rounding */
+	while (num_large > 0) {
+		range->prob[large[--num_large]] = 1.0;
+	}
+
+	while (num_small > 0) {
+		range->prob[small[--num_small]] = 1.0;
+	}
+
+	return range->count;
+}
+
+/**
+ * Deal every range player a combo, by weight and without card conflicts
+ *
+ * Each range is drawn from independently and the whole deal is redrawn if
+ * two players' combos share a card, which gives each deal its correct
+ * probability given the other players' cards.
+ *
+ * @param eq Equity state; hole cards of range players are filled in
+ * @param rng Random stream
+ * @param used Receives the mask of cards dealt to range players
+ * @return int SUCCESS, or FAILURE if no deal was found after many attempts
+ */
+static int php_poker_sample_ranges(php_poker_equity *eq, php_poker_rng *rng, uint64_t *used)
+{
+	const php_poker_range *range;
+	uint64_t mask;
+	int attempts, j, k;
+
+	for (attempts = 0; attempts < PHP_POKER_MAX_REJECTS; attempts++) {
+		mask = 0;
+
+		for (j = 0; j < eq->num_players; j++) {
+			if (!(range = eq->ranges[j])) {
+				continue;
+			}
+
+			k = php_poker_rand_int(rng, range->count);
+
+			if ((php_poker_rng_next(rng) >> 11) * (1.0 / 9007199254740992.0) >= range->prob[k]) {
+				k = range->alias[k];
+			}
+
+			if (mask & range->masks[k]) {
+				break;
+			}
+
+			mask |= range->masks[k];
+			eq->combos[j] = k;
+		}
+
+		if (j < eq->num_players) {
+			continue;
+		}
+
+		for (j = 0; j < eq->num_players; j++) {
+			if (!(range = eq->ranges[j])) {
+				continue;
+			}
+
+			eq->player_hands[j][0] = range->cards[eq->combos[j]][0];
+			eq->player_hands[j][1] = range->cards[eq->combos[j]][1];
+
+			if (php_poker_tpt && eq->game == PHP_POKER_GAME_HOLDEM) {
+				eq->tpt_states[j] = php_poker_tpt_walk(PHP_POKER_TPT_START, eq->player_hands[j], 2);
+				eq->tpt_states[j] = php_poker_tpt_walk(eq->tpt_states[j], eq->board, eq->board_count);
+			}
+
+			if (eq->combo_stats) {
+				eq->combo_stats[range->first + eq->combos[j]][2]++;
+			}
+		}
+
+		*used = mask;
+		return SUCCESS;
+	}
+
+	return FAILURE;
+}
+
+/**
+ * Run Monte Carlo chunks of a job until none are left
+ *
+ * Each chunk starts from the job's deck with its own random stream and
+ * credits the participant's own counters, so no locking is needed apart
+ * from claiming the next chunk. Chunks are claimed in order and always
+ * finished, so the chunks run are a prefix even when the deadline stops
+ * the job early.
+ *
+ * @param job Simulation job
+ * @param result Counters of this participant (a copy of the job's equity state)
+ */
+static void php_poker_run_chunks(php_poker_job *job, php_poker_equity *result)
+{
+	php_poker_rng rng;
+	int deck[52];
+	int remaining_board_count = 5 - result->board_count;
+	int num_hole_cards = php_poker_game_hole_cards[result->game];
+	zend_long chunk, i, count;
+	uint64_t used, now;
+	int j, k, dealt;
+
+	for (;;) {
+		now = job->deadline ? php_poker_clock() : 0;
+
+		/* Past the deadline no new chunk is started, but the first always is */
+		pthread_mutex_lock(&job->lock);
+
+		if (now >= job->deadline && job->deadline && job->next_chunk > 0) {
+			job->expired = 1;
+		}
+
+		chunk = !job->expired && job->next_chunk < job->num_chunks ? job->next_chunk++ : -1;
+		pthread_mutex_unlock(&job->lock);
+
+		if (chunk < 0) {
+			break;
+		}
+
+		count = job->iterations - chunk * PHP_POKER_CHUNK_SIZE;
+
+		if (count > PHP_POKER_CHUNK_SIZE) {
+			count = PHP_POKER_CHUNK_SIZE;
+		}
+
+		memcpy(deck, job->deck, sizeof(int) * job->num_cards);
+		php_poker_rng_seed(&rng, job->seed, (uint64_t)chunk);
+
+		for (i = 0; i < count; i++) {
+			if (result->num_ranges) {
+				/* Deal the hand ranges first, then the board around them */
+				if (php_poker_sample_ranges(result, &rng, &used) == FAILURE) {
+					pthread_mutex_lock(&job->lock);
+					job->failed = 1;
+					job->next_chunk = job->num_chunks;
+					pthread_mutex_unlock(&job->lock);
+					return;
+				}
+
+				php_poker_deal_cards_excluding(&rng, deck, job->num_cards, remaining_board_count + result->num_unknown, used);
+			} else {
+				/* Deal remaining board cards and unknown hole cards in one draw */
+				php_poker_deal_cards(&rng, deck, job->num_cards, remaining_board_count + result->num_unknown);
+			}
+
+			for (j = 0; j < remaining_board_count; j++) {
+				result->board[result->board_count + j] = deck[j];
+			}
+
+			/* The rest of the draw fills the unknown hole card slots */
+			for (j = 0, dealt = remaining_board_count; j < result->num_players && result->num_unknown; j++) {
+				if (!result->unknown[j]) {
+					continue;
+				}
+
+				for (k = num_hole_cards - result->unknown[j]; k < num_hole_cards; k++) {
+					result->player_hands[j][k] = deck[dealt++];
+				}
+
+				if (php_poker_tpt && result->game == PHP_POKER_GAME_HOLDEM) {
+					result->tpt_states[j] = php_poker_tpt_walk(PHP_POKER_TPT_START, result->player_hands[j], 2);
+					result->tpt_states[j] = php_poker_tpt_walk(result->tpt_states[j], result->board, result->board_count);
+				}
+			}
+
+			php_poker_showdown(result, 1);
+		}
+	}
+}
+
+/**
+ * Worker thread of the simulation pool
+ *
+ * Workers sleep until a new job is posted, take part in it if their index is
+ * below the job's thread count, and report back when they run out of chunks.
+ * They never call into the engine, so they are safe in ZTS builds.
+ *
+ * @param arg Pointer to the worker's php_poker_worker
+ * @return void* Always NULL
+ */
+static void *php_poker_pool_worker(void *arg)
+{
+	php_poker_pool *pool = &php_poker_pool_state;
+	int index = ((php_poker_worker *)arg)->index;
+	unsigned seen = ((php_poker_worker *)arg)->generation;
+	php_poker_job *job;
+
+	pthread_mutex_lock(&pool->lock);
+
+	for (;;) {
+		while (!pool->shutdown && pool->generation == seen) {
+			pthread_cond_wait(&pool->work, &pool->lock);
+		}
+
+		if (pool->shutdown) {
+			break;
+		}
+
+		seen = pool->generation;
+		job = pool->job;
+
+		if (!job || index >= job->num_threads) {
+			continue;
+		}
+
+		pthread_mutex_unlock(&pool->lock);
+		php_poker_run_chunks(job, &job->results[index]);
+		pthread_mutex_lock(&pool->lock);
+
+		if (--pool->active == 0) {
+			pthread_cond_signal(&pool->done);
+		}
+	}
+
+	pthread_mutex_unlock(&pool->lock);
+
+	return NULL;
+}
+
+/**
+ * Make sure the pool has at least the given number of workers
+ *
+ * The pool is started on first use rather than in MINIT, since php-fpm forks
+ * its children after MINIT and threads do not survive a fork. A child that
+ * inherits the state of a pool started by its parent starts over.
+ *
+ * Must be called with the pool lock held.
+ *
+ * @param num_workers Number of worker threads wanted
+ * @return int Number of worker threads running
+ */
+static int php_poker_pool_grow(int num_workers)
+{
+	php_poker_pool *pool = &php_poker_pool_state;
+
+	if (pool->num_threads > 0 && pool->pid != getpid()) {
+		pool->num_threads = 0;
+		pool->active = 0;
+		pool->job = NULL;
+	}
+
+	pool->pid = getpid();
+
+	while (pool->num_threads < num_workers) {
+		/* A new worker must not skip the job about to be posted */
+		pool->workers[pool->num_threads].index = pool->num_threads + 1;
+		pool->workers[pool->num_threads].generation = pool->generation;
+
+		if (pthread_create(&pool->threads[pool->num_threads], NULL, php_poker_pool_worker, &pool->workers[pool->num_threads]) != 0) {
+			break;
+		}
+
+		pool->num_threads++;
+	}
+
+	return pool->num_threads;
+}
+
+/**
+ * Stop and join the pool's workers, if any were started by this process
+ */
+static void php_poker_pool_shutdown(void)
+{
+	php_poker_pool *pool = &php_poker_pool_state;
+	int i, num_threads;
+
+	pthread_mutex_lock(&pool->lock);
+
+	if (pool->num_threads == 0 || pool->pid != getpid()) {
+		pool->num_threads = 0;
+		pthread_mutex_unlock(&pool->lock);
+		return;
+	}
+
+	pool->shutdown = 1;
+	num_threads = pool->num_threads;
+	pthread_cond_broadcast(&pool->work);
+	pthread_mutex_unlock(&pool->lock);
+
+	for (i = 0; i < num_threads; i++) {
+		pthread_join(pool->threads[i], NULL);
+	}
+
+	pool->num_threads = 0;
+	pool->shutdown = 0;
+}
+
+/**
+ * Standard error of a player's Monte Carlo equity
+ *
+ * Each iteration pays the player a share of the pot (1 for a win, 1/2 for
+ * a tie, or the units won in hi-lo), so the counters give both the mean and
+ * the mean square of that share.
+ *
+ * @param eq Equity state with the counters of the iterations run
+ * @param player Player index
+ * @param iterations Number of iterations the counters are out of
+ * @return double Standard error in percentage points
+ */
+static double php_poker_std_error(const php_poker_equity *eq, int player, zend_long iterations)
+{
+	double mean, square, variance;
+
+	if (iterations < 2) {
+		return 100.0;
+	}
+
+	if (eq->hilo) {
+		mean = (double)eq->shares[player] / PHP_POKER_POT_UNITS / iterations;
+		square = (double)eq->share_squares[player] / PHP_POKER_POT_UNITS / PHP_POKER_POT_UNITS / iterations;
+	} else {
+		mean = (eq->wins[player] + eq->ties[player] / 2.0) / iterations;
+		square = (eq->wins[player] + eq->ties[player] / 4.0) / iterations;
+	}
+
+	variance = (square - mean * mean) * iterations / (iterations - 1);
+
+	return variance > 0.0 ? 100.0 * sqrt(variance / iterations) : 0.0;
+}
+
+/**
+ * Pick the end of the next round of an adaptive simulation
+ *
+ * Estimates how many iterations the noisiest player needs to reach the
+ * target standard error, and runs up to there, but at least a quarter more
+ * than has been run so far. Rounds only depend on the counters, never on
+ * the thread count, so a seed still gives the same result.
+ *
+ * @param eq Equity state with the counters of the chunks run
+ * @param done_chunks Number of chunks run so far (at least one)
+ * @param num_chunks Most chunks the simulation may run
+ * @param iterations Number of iterations the counters are out of
+ * @param precision Target standard error in percentage points
+ * @return zend_long Chunk to stop the next round at, or done_chunks when every player is within the target
+ */
+static zend_long php_poker_next_round(const php_poker_equity *eq, zend_long done_chunks, zend_long num_chunks, zend_long iterations, double precision)
+{
+	double error, needed = 0.0;
+	zend_long end;
+	int j;
+
+	for (j = 0; j < eq->num_players; j++) {
+		error = php_poker_std_error(eq, j, iterations);
+
+		/* The standard error shrinks with the square root of the iterations */
+		if (error > precision && error * error / (precision * precision) * iterations > needed) {
+			needed = error * error / (precision * precision) * iterations;
+		}
+	}
+
+	if (needed == 0.0) {
+		return done_chunks;
+	}
+
+	end = (zend_long)(needed / PHP_POKER_CHUNK_SIZE) + 1;
+
+	if (end < done_chunks + (done_chunks + 3) / 4) {
+		end = done_chunks + (done_chunks + 3) / 4;
+	}
+
+	return end < num_chunks ? end : num_chunks;
+}
+
+/**
+ * Run a range of chunks of a Monte Carlo job, split across the worker pool
+ *
+ * The per-participant counters are summed into eq at the end. When the pool
+ * is busy with another request thread's job, the chunks run on the calling
+ * thread alone.
+ *
+ * @param job Simulation job, with next_chunk and num_chunks set to the range to run
+ * @param eq Equity state (wins/ties are credited per iteration)
+ * @param num_threads Number of threads to use, including the caller
+ * @param num_combos Number of per-combo counters in eq->combo_stats
+ */
+static void php_poker_run_job(php_poker_job *job, php_poker_equity *eq, int num_threads, int num_combos)
+{
+	php_poker_pool *pool = &php_poker_pool_state;
+	int i, j, k;
+
+	if (num_threads > job->num_chunks - job->next_chunk) {
+		num_threads = (int)(job->num_chunks - job->next_chunk);
+	}
+
+	if (num_threads > 1) {
+		pthread_mutex_lock(&pool->lock);
+
+		if (pool->job || pool->shutdown) {
+			num_threads = 1;
+		} else if (php_poker_pool_grow(num_threads - 1) + 1 < num_threads) {
+			num_threads = pool->num_threads + 1;
+		}
+
+		if (num_threads > 1) {
+			job->num_threads = num_threads;
+
+			for (i = 0; i < num_threads; i++) {
+				job->results[i] = *eq;
+				memset(job->results[i].wins, 0, sizeof(job->results[i].wins));
+				memset(job->results[i].ties, 0, sizeof(job->results[i].ties));
+				memset(job->results[i].shares, 0, sizeof(job->results[i].shares));
+				memset(job->results[i].share_squares, 0, sizeof(job->results[i].share_squares));
+				memset(job->results[i].scoops, 0, sizeof(job->results[i].scoops));
+				memset(job->results[i].high_only, 0, sizeof(job->results[i].high_only));
+				memset(job->results[i].low_only, 0, sizeof(job->results[i].low_only));
+				memset(job->results[i].partial_scoops, 0, sizeof(job->results[i].partial_scoops));
+				memset(job->results[i].hand_counts, 0, sizeof(job->results[i].hand_counts));
+				memset(job->results[i].win_counts, 0, sizeof(job->results[i].win_counts));
+
+				/* The caller keeps crediting eq's own per-combo counters */
+				if (eq->combo_stats && i > 0) {
+					job->results[i].combo_stats = pecalloc(num_combos, sizeof(*eq->combo_stats), 1);
+				}
+			}
+
+			pool->job = job;
+			pool->active = num_threads - 1;
+			pool->generation++;
+			pthread_cond_broadcast(&pool->work);
+		}
+
+		pthread_mutex_unlock(&pool->lock);
+	}
+
+	if (num_threads <= 1) {
+		job->num_threads = 1;
+		php_poker_run_chunks(job, eq);
+		return;
+	}
+
+	php_poker_run_chunks(job, &job->results[0]);
+
+	pthread_mutex_lock(&pool->lock);
+
+	while (pool->active > 0) {
+		pthread_cond_wait(&pool->done, &pool->lock);
+	}
+
+	pool->job = NULL;
+	pthread_mutex_unlock(&pool->lock);
+
+	/* Merge the per-thread counters */
+	for (i = 0; i < num_threads; i++) {
+		for (j = 0; j < eq->num_players; j++) {
+			for (k = 0; k < 9; k++) {
+				eq->hand_counts[j][k] += job->results[i].hand_counts[j][k];
+				eq->win_counts[j][k] += job->results[i].win_counts[j][k];
+			}
+
+			eq->wins[j] += job->results[i].wins[j];
+			eq->ties[j] += job->results[i].ties[j];
+			eq->shares[j] += job->results[i].shares[j];
+			eq->share_squares[j] += job->results[i].share_squares[j];
+			eq->scoops[j] += job->results[i].scoops[j];
+			eq->high_only[j] += job->results[i].high_only[j];
+			eq->low_only[j] += job->results[i].low_only[j];
+			eq->partial_scoops[j] += job->results[i].partial_scoops[j];
+		}
+
+		if (eq->combo_stats && i > 0) {
+			for (j = 0; j < num_combos; j++) {
+				eq->combo_stats[j][0] += job->results[i].combo_stats[j][0];
+				eq->combo_stats[j][1] += job->results[i].combo_stats[j][1];
+				eq->combo_stats[j][2] += job->results[i].combo_stats[j][2];
+			}
+
+			pefree(job->results[i].combo_stats, 1);
+		}
+	}
+}
+
+/**
+ * Run a Monte Carlo simulation, split across the worker pool
+ *
+ * Iterations are cut into fixed-size chunks, each with its own random stream,
+ * and the per-participant counters are summed at the end. The outcome for a
+ * given seed is therefore the same whatever the number of threads.
+ *
+ * With a target precision the chunks run in rounds, and the simulation stops
+ * after the first round that leaves every player's standard error within the
+ * target, or when the iterations run out. With a deadline, no chunk is
+ * started once it has passed, and the counters hold the chunks run so far.
+ *
+ * @param eq Equity state (wins/ties are credited per iteration)
+ * @param deck Array of cards left in the deck
+ * @param num_cards Number of cards left in the deck
+ * @param iterations Most iterations to run; receives the number run
+ * @param seed Seed of the random streams
+ * @param num_threads Number of threads to use, including the caller
+ * @param num_combos Number of per-combo counters in eq->combo_stats
+ * @param precision Target standard error in percentage points, or 0 to run every iteration
+ * @param deadline php_poker_clock time to stop at, or 0 for none
+ * @return int SUCCESS, or FAILURE if the hand ranges could not be dealt
+ */
+static int php_poker_simulate(php_poker_equity *eq, int *deck, int num_cards, zend_long *iterations, uint64_t seed, int num_threads, int num_combos, double precision, uint64_t deadline)
+{
+	php_poker_job *job;
+	zend_long num_chunks, end;
+	int result;
+
+	job = pemalloc(sizeof(php_poker_job), 1);
+	job->equity = eq;
+	job->deck = deck;
+	job->num_cards = num_cards;
+	job->iterations = *iterations;
+	job->seed = seed;
+	job->next_chunk = 0;
+	job->failed = 0;
+	job->deadline = deadline;
+	job->expired = 0;
+	job->num_combos = num_combos;
+	pthread_mutex_init(&job->lock, NULL);
+
+	num_chunks = (*iterations + PHP_POKER_CHUNK_SIZE - 1) / PHP_POKER_CHUNK_SIZE;
+	end = precision > 0.0 ? 1 : num_chunks;
+
+	while (end > job->next_chunk && !job->failed && !job->expired) {
+		job->num_chunks = end;
+		php_poker_run_job(job, eq, num_threads, num_combos);
+
+		/* Every chunk but the last is full */
+		*iterations = job->next_chunk == num_chunks ? job->iterations : job->next_chunk * PHP_POKER_CHUNK_SIZE;
+
+		if (precision > 0.0) {
+			end = php_poker_next_round(eq, job->next_chunk, num_chunks, *iterations, precision);
+		}
+	}
+
+	result = job->failed ? FAILURE : SUCCESS;
+
+	pthread_mutex_destroy(&job->lock);
+	pefree(job, 1);
+
+	return result;
+}
+
+/**
+ * Load the Two Plus Two state table, generating the file if it does not exist
+ *
+ * @param path File holding the table
+ * @return int SUCCESS or FAILURE
+ */
+static int php_poker_tpt_load(const char *path)
+{
+	struct stat st;
+
+	if (!path || !*path) {
+		return FAILURE;
+	}
+
+	if (stat(path, &st) != 0 && php_poker_tpt_generate(path) == FAILURE) {
+		return FAILURE;
+	}
+
+	return php_poker_tpt_map(path);
+}
+
+/**
+ * Canonical key of a heads-up preflop matchup
+ *
+ * Matchups that only differ by a renaming of the suits or by the order of
+ * the two hands have the same equities. The key is the smallest
+ * combo1 * 1326 + combo2 over all 24 suit permutations and both orders.
+ *
+ * @param hand1 First player's two cards
+ * @param hand2 Second player's two cards
+ * @param swapped Set to 1 if the key lists hand2 first, 0 otherwise
+ * @return uint32_t Canonical key
+ */
+static uint32_t php_poker_preflop_key(const int *hand1, const int *hand2, int *swapped)
+{
+	const unsigned char (*perms)[4] = php_poker_suit_perms;
+	uint32_t key, best = UINT32_MAX;
+	int p, combo1, combo2;
+
+	for (p = 0; p < 24; p++) {
+		combo1 = php_poker_combo_index(perms[p][php_poker_suit_index(hand1[0])] * 13 + RANK(hand1[0]), perms[p][php_poker_suit_index(hand1[1])] * 13 + RANK(hand1[1]));
+		combo2 = php_poker_combo_index(perms[p][php_poker_suit_index(hand2[0])] * 13 + RANK(hand2[0]), perms[p][php_poker_suit_index(hand2[1])] * 13 + RANK(hand2[1]));
+
+		if ((key = (uint32_t)combo1 * PHP_POKER_COMBOS + combo2) < best) {
+			best = key;
+			*swapped = 0;
+		}
+
+		if ((key = (uint32_t)combo2 * PHP_POKER_COMBOS + combo1) < best) {
+			best = key;
+			*swapped = 1;
+		}
+	}
+
+	return best;
+}
+
+/**
+ * Generate the heads-up preflop equity table and write it to a file
+ *
+ * Every canonical matchup is enumerated exactly over all 1,712,304 boards,
+ * in increasing key order so the file can be binary searched. This takes
+ * over an hour on one core; the file is written next to the target and
+ * renamed into place.
+ *
+ * @param path File to write
+ * @return int SUCCESS or FAILURE
+ */
+static int php_poker_preflop_generate(const char *path)
+{
+	php_poker_preflop_header header;
+	php_poker_preflop_entry entry;
+	php_poker_equity eq;
+	size_t tmp_len = strlen(path) + 32;
+	char *tmp_path;
+	FILE *fp;
+	int used[4], deck[52];
+	int combo1, combo2, swapped, num_cards;
+	uint32_t entries = 0;
+
+	tmp_path = pemalloc(tmp_len, 1);
+	snprintf(tmp_path, tmp_len, "%s.%ld.tmp", path, (long)getpid());
+
+	if ((fp = fopen(tmp_path, "wb")) == NULL) {
+		pefree(tmp_path, 1);
+		return FAILURE;
+	}
+
+	/* Entry count is filled in once the table is complete */
+	memset(&header, 0, sizeof(header));
+
+	if (fwrite(&header, sizeof(header), 1, fp) != 1) {
+		goto failure;
+	}
+
+	for (combo1 = 0; combo1 < PHP_POKER_COMBOS; combo1++) {
+		for (combo2 = 0; combo2 < PHP_POKER_COMBOS; combo2++) {
+			if (php_poker_combo_masks[combo1] & php_poker_combo_masks[combo2]) {
+				continue;
+			}
+
+			memset(&eq, 0, sizeof(eq));
+			eq.num_players = 2;
+			eq.player_hands[0][0] = used[0] = php_poker_make_card(php_poker_combo_cards[combo1][0] % 13, php_poker_combo_cards[combo1][0] / 13);
+			eq.player_hands[0][1] = used[1] = php_poker_make_card(php_poker_combo_cards[combo1][1] % 13, php_poker_combo_cards[combo1][1] / 13);
+			eq.player_hands[1][0] = used[2] = php_poker_make_card(php_poker_combo_cards[combo2][0] % 13, php_poker_combo_cards[combo2][0] / 13);
+			eq.player_hands[1][1] = used[3] = php_poker_make_card(php_poker_combo_cards[combo2][1] % 13, php_poker_combo_cards[combo2][1] / 13);
+
+			/* Only the representative of each class is enumerated */
+			if (php_poker_preflop_key(eq.player_hands[0], eq.player_hands[1], &swapped) != (uint32_t)(combo1 * PHP_POKER_COMBOS + combo2)) {
+				continue;
+			}
+
+			if (php_poker_tpt) {
+				eq.tpt_states[0] = php_poker_tpt_walk(PHP_POKER_TPT_START, eq.player_hands[0], 2);
+				eq.tpt_states[1] = php_poker_tpt_walk(PHP_POKER_TPT_START, eq.player_hands[1], 2);
+			}
+
+			num_cards = php_poker_prepare_deck(deck, php_poker_cards_mask(used, 4));
+			php_poker_enumerate_boards(&eq, deck, num_cards, NULL, 0);
+
+			entry.key = (uint32_t)(combo1 * PHP_POKER_COMBOS + combo2);
+			entry.wins = (uint32_t)eq.wins[0];
+			entry.ties = (uint32_t)eq.ties[0];
+
+			if (fwrite(&entry, sizeof(entry), 1, fp) != 1) {
+				goto failure;
+			}
+
+			entries++;
+		}
+	}
+
+	memcpy(header.magic, PHP_POKER_PREFLOP_MAGIC, sizeof(header.magic));
+	header.version = PHP_POKER_PREFLOP_VERSION;
+	header.entries = entries;
+
+	if (entries != PHP_POKER_PREFLOP_ENTRIES
+		|| fseek(fp, 0, SEEK_SET) != 0
+		|| fwrite(&header, sizeof(header), 1, fp) != 1) {
+		goto failure;
+	}
+
+	if (fclose(fp) != 0 || rename(tmp_path, path) != 0) {
+		unlink(tmp_path);
+		pefree(tmp_path, 1);
+		return FAILURE;
+	}
+
+	pefree(tmp_path, 1);
+
+	return SUCCESS;
+
+failure:
+	fclose(fp);
+	unlink(tmp_path);
+	pefree(tmp_path, 1);
+
+	return FAILURE;
+}
+
+/**
+ * Map a heads-up preflop equity table file read-only
+ *
+ * @param path File to map
+ * @return int SUCCESS or FAILURE
+ */
+static int php_poker_preflop_map(const char *path)
+{
+	const php_poker_preflop_header *header;
+	struct stat st;
+	void *base;
+	int fd;
+
+	if (!path || !*path || (fd = open(path, O_RDONLY)) < 0) {
+		return FAILURE;
+	}
+
+	if (fstat(fd, &st) != 0 || (size_t)st.st_size != PHP_POKER_PREFLOP_FILE_SIZE) {
+		close(fd);
+		return FAILURE;
+	}
+
+	base = mmap(NULL, PHP_POKER_PREFLOP_FILE_SIZE, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if (base == MAP_FAILED) {
+		return FAILURE;
+	}
+
+	header = (const php_poker_preflop_header *)base;
+
+	if (memcmp(header->magic, PHP_POKER_PREFLOP_MAGIC, sizeof(header->magic)) != 0
+		|| header->version != PHP_POKER_PREFLOP_VERSION
+		|| header->entries != PHP_POKER_PREFLOP_ENTRIES) {
+		munmap(base, PHP_POKER_PREFLOP_FILE_SIZE);
+		return FAILURE;
+	}
+
+	php_poker_preflop_base = base;
+	php_poker_preflop = (const php_poker_preflop_entry *)((const char *)base + sizeof(php_poker_preflop_header));
+
+	return SUCCESS;
+}
+
+/**
+ * Release the heads-up preflop equity table mapping, if any
+ */
+static void php_poker_preflop_unmap(void)
+{
+	if (php_poker_preflop_base) {
+		munmap(php_poker_preflop_base, PHP_POKER_PREFLOP_FILE_SIZE);
+		php_poker_preflop_base = NULL;
+		php_poker_preflop = NULL;
+	}
+}
+
+/**
+ * Credit the exact heads-up preflop result from the table
+ *
+ * @param eq Equity state with two players, no board and no hand ranges
+ * @return int SUCCESS, or FAILURE if the table is not loaded
+ */
+static int php_poker_preflop_lookup(php_poker_equity *eq)
+{
+	uint32_t key, wins, ties;
+	int low = 0, high = PHP_POKER_PREFLOP_ENTRIES - 1, middle, swapped;
+
+	if (!php_poker_preflop) {
+		return FAILURE;
+	}
+
+	key = php_poker_preflop_key(eq->player_hands[0], eq->player_hands[1], &swapped);
+
+	while (low <= high) {
+		middle = (low + high) / 2;
+
+		if (php_poker_preflop[middle].key < key) {
+			low = middle + 1;
+		} else if (php_poker_preflop[middle].key > key) {
+			high = middle - 1;
+		} else {
+			wins = php_poker_preflop[middle].wins;
+			ties = php_poker_preflop[middle].ties;
+
+			eq->wins[swapped] = wins;
+			eq->wins[!swapped] = PHP_POKER_PREFLOP_BOARDS - wins - ties;
+			eq->ties[0] = eq->ties[1] = ties;
+
+			return SUCCESS;
+		}
+	}
+
+	return FAILURE;
+}
+
+/**
+ * Index of a starting hand class in the preflop chart
+ *
+ * Classes form a 13x13 grid: pairs on the diagonal, suited hands at
+ * [high][low] and offsuit hands at [low][high].
+ *
+ * @param high Higher rank (0-12)
+ * @param low Lower rank (0-12), equal to high for pairs
+ * @param suited Non-zero for suited hands
+ * @return int Class index (0-168)
+ */
+static inline int php_poker_chart_class(int high, int low, int suited)
+{
+	return suited || high == low ? high * 13 + low : low * 13 + high;
+}
+
+/**
+ * Share of the pot won by a hand against random opponents, all in preflop
+ *
+ * Opponents' hole cards and the board are dealt from the rest of the deck
+ * every iteration. A pot split k ways counts 1/k for the hand.
+ *
+ * @param hand The hand's two cards
+ * @param opponents Number of random opponents (1-9)
+ * @param iterations Number of deals
+ * @param seed Random seed
+ * @return double Pot share in percent
+ */
+static double php_poker_chart_equity(int *hand, int opponents, zend_long iterations, uint64_t seed)
+{
+	php_poker_board_state board;
+	php_poker_rng rng;
+	int deck[52];
+	unsigned short score, best;
+	zend_long i;
+	double share = 0.0;
+	int num_cards, j, tied;
+
+	num_cards = php_poker_prepare_deck(deck, php_poker_cards_mask(hand, 2));
+	php_poker_rng_seed(&rng, seed, 0);
+
+	for (i = 0; i < iterations; i++) {
+		php_poker_deal_cards(&rng, deck, num_cards, 5 + opponents * 2);
+		php_poker_init_board_state(&board, deck, 5, PHP_POKER_GAME_HOLDEM);
+
+		best = php_poker_eval_board_hand(&board, hand[0], hand[1]);
+		tied = 1;
+
+		for (j = 0; j < opponents; j++) {
+			score = php_poker_eval_board_hand(&board, deck[5 + j * 2], deck[6 + j * 2]);
+
+			if (score < best) {
+				break;
+			}
+
+			tied += score == best;
+		}
+
+		if (j == opponents) {
+			share += 1.0 / tied;
+		}
+	}
+
+	return share / iterations * 100.0;
+}
+
+/**
+ * Generate the preflop chart and write it as a C header
+ *
+ * Heads-up cells are exact when the preflop table is loaded (the average
+ * over every opponent combo); all other cells are sampled. The output
+ * replaces src/preflop_chart.h.
+ *
+ * @param path File to write
+ * @param iterations Deals per sampled cell
+ * @return int SUCCESS or FAILURE
+ */
+static int php_poker_chart_generate(const char *path, zend_long iterations)
+{
+	static const char ranks[] = "23456789TJQKA";
+	php_poker_equity eq;
+	uint64_t hand_mask;
+	int high, low, suited, opponents, cls, combo, matchups;
+	int hand[2];
+	double equity;
+	FILE *fp;
+
+	if ((fp = fopen(path, "w")) == NULL) {
+		return FAILURE;
+	}
+
+	fprintf(fp, "/*\n** Preflop equity chart: pot share of each starting hand class against\n");
+	fprintf(fp, "** 1-9 random opponents, in hundredths of a percent, indexed by\n");
+	fprintf(fp, "** php_poker_chart_class(). Generated by poker_generate_preflop_chart()\n");
+	fprintf(fp, "** with %ld deals per sampled cell%s. Do not edit.\n*/\n", (long)iterations,
+		php_poker_preflop ? " (heads-up cells are exact)" : "");
+	fprintf(fp, "static const unsigned short php_poker_preflop_chart[169][9] =\n{\n");
+
+	for (cls = 0; cls < 169; cls++) {
+		high = cls / 13 >= cls % 13 ? cls / 13 : cls % 13;
+		low = cls / 13 >= cls % 13 ? cls % 13 : cls / 13;
+		suited = cls / 13 > cls % 13;
+
+		/* Clubs for the first card, and for the second when suited */
+		hand[0] = php_poker_make_card(high, 0);
+		hand[1] = php_poker_make_card(low, suited ? 0 : 1);
+		hand_mask = php_poker_card_bit(hand[0]) | php_poker_card_bit(hand[1]);
+
+		fprintf(fp, "    {");
+
+		for (opponents = 1; opponents <= 9; opponents++) {
+			if (opponents == 1 && php_poker_preflop) {
+				/* Average of the exact result against every opponent combo */
+				memset(&eq, 0, sizeof(eq));
+				eq.num_players = 2;
+				eq.player_hands[0][0] = hand[0];
+				eq.player_hands[0][1] = hand[1];
+				equity = 0.0;
+				matchups = 0;
+
+				for (combo = 0; combo < PHP_POKER_COMBOS; combo++) {
+					if (php_poker_combo_masks[combo] & hand_mask) {
+						continue;
+					}
+
+					eq.player_hands[1][0] = php_poker_make_card(php_poker_combo_cards[combo][0] % 13, php_poker_combo_cards[combo][0] / 13);
+					eq.player_hands[1][1] = php_poker_make_card(php_poker_combo_cards[combo][1] % 13, php_poker_combo_cards[combo][1] / 13);
+					php_poker_preflop_lookup(&eq);
+
+					equity += (eq.wins[0] + eq.ties[0] / 2.0) / PHP_POKER_PREFLOP_BOARDS;
+					matchups++;
+				}
+
+				equity = equity / matchups * 100.0;
+			} else {
+				equity = php_poker_chart_equity(hand, opponents, iterations, (uint64_t)(cls * 9 + opponents));
+			}
+
+			fprintf(fp, "%s%5u", opponents == 1 ? "" : ", ", (unsigned)(equity * 100.0 + 0.5));
+		}
+
+		fprintf(fp, "}%s /* %c%c%s */\n", cls == 168 ? " " : ",", ranks[high], ranks[low], high == low ? "" : (suited ? "s" : "o"));
+	}
+
+	fprintf(fp, "};\n");
+
+	return fclose(fp) == 0 ? SUCCESS : FAILURE;
+}
+
+/**
+ * Look up the preflop chart for a starting hand class
+ *
+ * A class given without "s" or "o" (e.g. "AK") is the combo-weighted
+ * average of its 4 suited and 12 offsuit combos.
+ *
+ * @param high Higher rank (0-12)
+ * @param low Lower rank (0-12), equal to high for pairs
+ * @param suitedness PHP_POKER_SUITED, PHP_POKER_OFFSUIT or both
+ * @param opponents Number of random opponents (1-9)
+ * @return double Pot share in percent
+ */
+static double php_poker_chart_lookup(int high, int low, int suitedness, int opponents)
+{
+	unsigned suited = php_poker_preflop_chart[php_poker_chart_class(high, low, 1)][opponents - 1];
+	unsigned offsuit = php_poker_preflop_chart[php_poker_chart_class(high, low, 0)][opponents - 1];
+
+	if (high == low || suitedness == PHP_POKER_SUITED) {
+		return suited / 100.0;
+	}
+
+	if (suitedness == PHP_POKER_OFFSUIT) {
+		return offsuit / 100.0;
+	}
+
+	return (suited * 4 + offsuit * 12) / 1600.0;
+}
+
+/**
+ * Rename the suits of a card mask
+ *
+ * @param mask Card mask
+ * @param perm New suit index of each suit index
+ * @return uint64_t Card mask with every card moved to its new suit
+ */
+static inline uint64_t php_poker_permute_mask(uint64_t mask, const unsigned char *perm)
+{
+	return ((mask & 0x1fff) << (13 * perm[0]))
+		| (((mask >> 13) & 0x1fff) << (13 * perm[1]))
+		| (((mask >> 26) & 0x1fff) << (13 * perm[2]))
+		| (((mask >> 39) & 0x1fff) << (13 * perm[3]));
+}
+
+/**
+ * Canonical cache key of an equity scenario
+ *
+ * Scenarios that only differ by a renaming of the suits or by the order of
+ * the players have the same equities, player for player. The key holds the
+ * hands sorted by card mask under the suit renaming that gives the smallest
+ * board, dead cards and hands, in that order. Only the cards and the game
+ * are filled in; the caller adds the settings the result depends on.
+ *
+ * @param key Key to fill in
+ * @param eq Equity state with the players' hole cards and the board
+ * @param dead Card mask of the dead cards
+ * @param order Set to the caller's player for each slot of the key
+ */
+static void php_poker_cache_key_init(php_poker_cache_key *key, const php_poker_equity *eq, uint64_t dead, int *order)
+{
+	uint64_t hands[10], board = php_poker_cards_mask(eq->board, eq->board_count);
+	uint64_t masks[10], board_mask, dead_mask;
+	int slots[10];
+	int num_hole_cards = php_poker_game_hole_cards[eq->game];
+	int p, i, j, slot, cmp, found = 0;
+	uint64_t mask;
+
+	/* The padding is compared and hashed too */
+	memset(key, 0, sizeof(*key));
+	key->num_players = eq->num_players;
+	key->game = eq->game;
+	key->hilo = eq->hilo;
+
+	for (i = 0; i < eq->num_players; i++) {
+		hands[i] = php_poker_cards_mask(eq->player_hands[i], num_hole_cards);
+	}
+
+	for (p = 0; p < 24; p++) {
+		board_mask = php_poker_permute_mask(board, php_poker_suit_perms[p]);
+		dead_mask = php_poker_permute_mask(dead, php_poker_suit_perms[p]);
+
+		/* Insertion sort, the hands never share a card */
+		for (i = 0; i < eq->num_players; i++) {
+			mask = php_poker_permute_mask(hands[i], php_poker_suit_perms[p]);
+
+			for (j = i; j > 0 && masks[j - 1] > mask; j--) {
+				masks[j] = masks[j - 1];
+				slots[j] = slots[j - 1];
+			}
+
+			masks[j] = mask;
+			slots[j] = i;
+		}
+
+		cmp = !found ? -1 : board_mask != key->board ? (board_mask < key->board ? -1 : 1)
+			: dead_mask != key->dead ? (dead_mask < key->dead ? -1 : 1) : 0;
+
+		for (slot = 0; cmp == 0 && slot < eq->num_players; slot++) {
+			if (masks[slot] != key->hands[slot]) {
+				cmp = masks[slot] < key->hands[slot] ? -1 : 1;
+			}
+		}
+
+		if (cmp < 0) {
+			key->board = board_mask;
+			key->dead = dead_mask;
+			memcpy(key->hands, masks, sizeof(uint64_t) * eq->num_players);
+			memcpy(order, slots, sizeof(int) * eq->num_players);
+			found = 1;
+		}
+	}
+}
+
+/**
+ * Copy a calculation's counters into a cache result, in key order
+ *
+ * @param result Cache result to fill in
+ * @param eq Equity state holding the counters
+ * @param order Caller's player for each slot of the key
+ * @param total Number of boards the counters are out of
+ */
+static void php_poker_cache_save(php_poker_cache_result *result, const php_poker_equity *eq, const int *order, zend_long total)
+{
+	int slot, p;
+
+	memset(result, 0, sizeof(*result));
+	result->total = total;
+
+	for (slot = 0; slot < eq->num_players; slot++) {
+		p = order[slot];
+		result->wins[slot] = eq->wins[p];
+		result->ties[slot] = eq->ties[p];
+		result->shares[slot] = eq->shares[p];
+		result->share_squares[slot] = eq->share_squares[p];
+		result->scoops[slot] = eq->scoops[p];
+		result->high_only[slot] = eq->high_only[p];
+		result->low_only[slot] = eq->low_only[p];
+		result->partial_scoops[slot] = eq->partial_scoops[p];
+	}
+}
+
+/**
+ * Copy a cache result's counters back to the caller's players
+ *
+ * @param eq Equity state to fill in
+ * @param result Cached result, in key order
+ * @param order Caller's player for each slot of the key
+ */
+static void php_poker_cache_restore(php_poker_equity *eq, const php_poker_cache_result *result, const int *order)
+{
+	int slot, p;
+
+	for (slot = 0; slot < eq->num_players; slot++) {
+		p = order[slot];
+		eq->wins[p] = result->wins[slot];
+		eq->ties[p] = result->ties[slot];
+		eq->shares[p] = result->shares[slot];
+		eq->share_squares[p] = result->share_squares[slot];
+		eq->scoops[p] = result->scoops[slot];
+		eq->high_only[p] = result->high_only[slot];
+		eq->low_only[p] = result->low_only[slot];
+		eq->partial_scoops[p] = result->partial_scoops[slot];
+	}
+}
+
+/**
+ * Allocate the per-process result cache
+ *
+ * @param capacity Number of results to keep
+ */
+static void php_poker_cache_init(zend_long capacity)
+{
+	php_poker_cache *cache = &php_poker_cache_state;
+
+	cache->capacity = (int)capacity;
+	cache->num_buckets = 1;
+
+	while (cache->num_buckets < cache->capacity) {
+		cache->num_buckets <<= 1;
+	}
+
+	cache->entries = pecalloc(cache->capacity, sizeof(php_poker_cache_entry), 1);
+	cache->buckets = pemalloc(sizeof(int) * cache->num_buckets, 1);
+	php_poker_cache_clear();
+}
+
+/**
+ * Drop every cached result and reset the statistics
+ */
+static void php_poker_cache_clear(void)
+{
+	php_poker_cache *cache = &php_poker_cache_state;
+
+	pthread_mutex_lock(&cache->lock);
+	memset(cache->buckets, 0xff, sizeof(int) * cache->num_buckets);
+	cache->count = 0;
+	cache->newest = -1;
+	cache->oldest = -1;
+	cache->hits = 0;
+	cache->misses = 0;
+	cache->evictions = 0;
+	pthread_mutex_unlock(&cache->lock);
+}
+
+/**
+ * Release the per-process result cache, if any
+ */
+static void php_poker_cache_free(void)
+{
+	php_poker_cache *cache = &php_poker_cache_state;
+
+	if (cache->entries) {
+		pefree(cache->entries, 1);
+		pefree(cache->buckets, 1);
+		cache->entries = NULL;
+		cache->buckets = NULL;
+	}
+}
+
+/**
+ * Take an entry out of the recently used list
+ *
+ * @param cache Result cache
+ * @param index Entry to unlink
+ */
+static void php_poker_cache_unlink(php_poker_cache *cache, int index)
+{
+	php_poker_cache_entry *entry = &cache->entries[index];
+
+	if (entry->newer >= 0) {
+		cache->entries[entry->newer].older = entry->older;
+	} else {
+		cache->newest = entry->older;
+	}
+
+	if (entry->older >= 0) {
+		cache->entries[entry->older].newer = entry->newer;
+	} else {
+		cache->oldest = entry->newer;
+	}
+}
+
+/**
+ * Put an entry at the front of the recently used list
+ *
+ * @param cache Result cache
+ * @param index Entry to link
+ */
+static void php_poker_cache_link(php_poker_cache *cache, int index)
+{
+	php_poker_cache_entry *entry = &cache->entries[index];
+
+	entry->newer = -1;
+	entry->older = cache->newest;
+
+	if (cache->newest >= 0) {
+		cache->entries[cache->newest].newer = index;
+	} else {
+		cache->oldest = index;
+	}
+
+	cache->newest = index;
+}
+
+/**
+ * Find a scenario's entry, with the cache locked
+ *
+ * @param cache Result cache
+ * @param key Canonical scenario
+ * @param hash Hash of the key
+ * @return int Entry index, or -1 when the scenario is not cached
+ */
+static int php_poker_cache_find(php_poker_cache *cache, const php_poker_cache_key *key, zend_ulong hash)
+{
+	int index = cache->buckets[hash & (cache->num_buckets - 1)];
+
+	while (index >= 0 && (cache->entries[index].hash != hash || memcmp(&cache->entries[index].key, key, sizeof(*key)) != 0)) {
+		index = cache->entries[index].next;
+	}
+
+	return index;
+}
+
+/**
+ * Look up a scenario's result and mark it as recently used
+ *
+ * @param key Canonical scenario
+ * @param result Set to the cached result on a hit
+ * @return int SUCCESS on a hit, FAILURE on a miss
+ */
+static int php_poker_cache_get(const php_poker_cache_key *key, php_poker_cache_result *result)
+{
+	php_poker_cache *cache = &php_poker_cache_state;
+	zend_ulong hash = zend_inline_hash_func((const char *)key, sizeof(*key));
+	int index;
+
+	pthread_mutex_lock(&cache->lock);
+	index = php_poker_cache_find(cache, key, hash);
+
+	if (index < 0) {
+		cache->misses++;
+		pthread_mutex_unlock(&cache->lock);
+		return FAILURE;
+	}
+
+	cache->hits++;
+	memcpy(result, &cache->entries[index].result, sizeof(*result));
+	php_poker_cache_unlink(cache, index);
+	php_poker_cache_link(cache, index);
+	pthread_mutex_unlock(&cache->lock);
+
+	return SUCCESS;
+}
+
+/**
+ * Store a scenario's result, evicting the least recently used one when full
+ *
+ * @param key Canonical scenario
+ * @param result Result to keep, in key order
+ */
+static void php_poker_cache_put(const php_poker_cache_key *key, const php_poker_cache_result *result)
+{
+	php_poker_cache *cache = &php_poker_cache_state;
+	zend_ulong hash = zend_inline_hash_func((const char *)key, sizeof(*key));
+	int index, *link;
+
+	pthread_mutex_lock(&cache->lock);
+
+	/* Another request may have stored it meanwhile */
+	if ((index = php_poker_cache_find(cache, key, hash)) >= 0) {
+		php_poker_cache_unlink(cache, index);
+	} else {
+		if (cache->count < cache->capacity) {
+			index = cache->count++;
+		} else {
+			/* Reuse the oldest entry, taking it out of its bucket first */
+			index = cache->oldest;
+			php_poker_cache_unlink(cache, index);
+
+			for (link = &cache->buckets[cache->entries[index].hash & (cache->num_buckets - 1)]; *link != index; link = &cache->entries[*link].next);
+
+			*link = cache->entries[index].next;
+			cache->evictions++;
+		}
+
+		/* Copied bytewise, so the zeroed padding still compares equal */
+		memcpy(&cache->entries[index].key, key, sizeof(*key));
+		cache->entries[index].hash = hash;
+		cache->entries[index].next = cache->buckets[hash & (cache->num_buckets - 1)];
+		cache->buckets[hash & (cache->num_buckets - 1)] = index;
+	}
+
+	memcpy(&cache->entries[index].result, result, sizeof(*result));
+	php_poker_cache_link(cache, index);
+	pthread_mutex_unlock(&cache->lock);
+}
+
+/**
+ * Create the shared-memory result cache
+ *
+ * The segment is an anonymous shared mapping made before the server forks
+ * its workers, so every child process sees the same one. Slots are grouped
+ * into sets of PHP_POKER_SHM_WAYS, and each set is guarded by one of
+ * PHP_POKER_SHM_SHARDS process-shared locks.
+ *
+ * @param capacity Number of results to keep (rounded up to whole sets)
+ * @param ttl Seconds a result stays valid, 0 for no limit
+ * @return int SUCCESS or FAILURE
+ */
+static int php_poker_shm_init(zend_long capacity, zend_long ttl)
+{
+	php_poker_shm *shm;
+	pthread_mutexattr_t attr;
+	zend_ulong num_sets = (capacity + PHP_POKER_SHM_WAYS - 1) / PHP_POKER_SHM_WAYS;
+	size_t size = sizeof(php_poker_shm) + sizeof(php_poker_shm_slot) * PHP_POKER_SHM_WAYS * num_sets;
+	int i;
+
+	shm = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+	if (shm == MAP_FAILED) {
+		return FAILURE;
+	}
+
+	/* A fresh anonymous mapping is already zeroed: every slot is empty */
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+#ifdef __linux__
+	pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+#endif
+
+	for (i = 0; i < PHP_POKER_SHM_SHARDS; i++) {
+		if (pthread_mutex_init(&shm->locks[i], &attr) != 0) {
+			pthread_mutexattr_destroy(&attr);
+			munmap(shm, size);
+			return FAILURE;
+		}
+	}
+
+	pthread_mutexattr_destroy(&attr);
+
+	shm->num_sets = num_sets;
+	shm->ttl = ttl > 0 ? ttl : 0;
+	php_poker_shm_cache = shm;
+	php_poker_shm_size = size;
+
+	return SUCCESS;
+}
+
+/**
+ * Release this process's mapping of the shared-memory cache, if any
+ */
+static void php_poker_shm_free(void)
+{
+	if (php_poker_shm_cache) {
+		munmap(php_poker_shm_cache, php_poker_shm_size);
+		php_poker_shm_cache = NULL;
+	}
+}
+
+/**
+ * Empty slots of the shared-memory cache, with their shard locked
+ *
+ * @param shm Shared-memory cache
+ * @param slots First slot to empty
+ * @param count Number of slots
+ */
+static void php_poker_shm_drop(php_poker_shm *shm, php_poker_shm_slot *slots, int count)
+{
+	int i;
+
+	for (i = 0; i < count; i++) {
+		if (slots[i].hash) {
+			__atomic_fetch_sub(&shm->entries, 1, __ATOMIC_RELAXED);
+		}
+	}
+
+	memset(slots, 0, sizeof(php_poker_shm_slot) * count);
+}
+
+/**
+ * Lock the shard guarding a set
+ *
+ * If a process died holding the lock, the sets it guards may be half
+ * written, so they are emptied before the lock is marked usable again.
+ *
+ * @param shm Shared-memory cache
+ * @param set Set about to be read or written
+ * @return pthread_mutex_t* The lock taken
+ */
+static pthread_mutex_t *php_poker_shm_lock(php_poker_shm *shm, zend_ulong set)
+{
+	pthread_mutex_t *lock = &shm->locks[set % PHP_POKER_SHM_SHARDS];
+
+#ifdef __linux__
+	zend_ulong i;
+
+	if (pthread_mutex_lock(lock) == EOWNERDEAD) {
+		for (i = (set % PHP_POKER_SHM_SHARDS) * PHP_POKER_SHM_WAYS; i < shm->num_sets * PHP_POKER_SHM_WAYS; i += PHP_POKER_SHM_SHARDS * PHP_POKER_SHM_WAYS) {
+			php_poker_shm_drop(shm, &shm->slots[i], PHP_POKER_SHM_WAYS);
+		}
+
+		pthread_mutex_consistent(lock);
+	}
+#else
+	pthread_mutex_lock(lock);
+#endif
+
+	return lock;
+}
+
+/**
+ * Look up a scenario's result in the shared-memory cache
+ *
+ * @param key Canonical scenario
+ * @param result Set to the cached result on a hit
+ * @return int SUCCESS on a hit, FAILURE on a miss or an expired result
+ */
+static int php_poker_shm_get(const php_poker_cache_key *key, php_poker_cache_result *result)
+{
+	php_poker_shm *shm = php_poker_shm_cache;
+	zend_ulong hash = zend_inline_hash_func((const char *)key, sizeof(*key));
+	zend_ulong set = hash % shm->num_sets;
+	php_poker_shm_slot *slots = &shm->slots[set * PHP_POKER_SHM_WAYS];
+	pthread_mutex_t *lock;
+	int64_t now = (int64_t)time(NULL);
+	int i;
+
+	lock = php_poker_shm_lock(shm, set);
+
+	for (i = 0; i < PHP_POKER_SHM_WAYS; i++) {
+		if (slots[i].hash == hash && memcmp(&slots[i].key, key, sizeof(*key)) == 0) {
+			if (shm->ttl && now - slots[i].stored >= shm->ttl) {
+				break;
+			}
+
+			memcpy(result, &slots[i].result, sizeof(*result));
+			slots[i].used = now;
+			pthread_mutex_unlock(lock);
+			__atomic_fetch_add(&shm->hits, 1, __ATOMIC_RELAXED);
+
+			return SUCCESS;
+		}
+	}
+
+	pthread_mutex_unlock(lock);
+	__atomic_fetch_add(&shm->misses, 1, __ATOMIC_RELAXED);
+
+	return FAILURE;
+}
+
+/**
+ * Store a scenario's result in the shared-memory cache
+ *
+ * The result goes into the scenario's own slot if it has one, else an
+ * empty or expired slot of its set, else the set's least recently read one.
+ *
+ * @param key Canonical scenario
+ * @param result Result to keep, in key order
+ */
+static void php_poker_shm_put(const php_poker_cache_key *key, const php_poker_cache_result *result)
+{
+	php_poker_shm *shm = php_poker_shm_cache;
+	zend_ulong hash = zend_inline_hash_func((const char *)key, sizeof(*key));
+	zend_ulong set = hash % shm->num_sets;
+	php_poker_shm_slot *slots = &shm->slots[set * PHP_POKER_SHM_WAYS];
+	php_poker_shm_slot *slot = NULL;
+	pthread_mutex_t *lock;
+	int64_t now = (int64_t)time(NULL);
+	int i, found = 0;
+
+	lock = php_poker_shm_lock(shm, set);
+
+	for (i = 0; i < PHP_POKER_SHM_WAYS && !slot; i++) {
+		if (slots[i].hash == hash && memcmp(&slots[i].key, key, sizeof(*key)) == 0) {
+			slot = &slots[i];
+			found = 1;
+		}
+	}
+
+	for (i = 0; i < PHP_POKER_SHM_WAYS && !found; i++) {
+		if (!slots[i].hash || (shm->ttl && now - slots[i].stored >= shm->ttl)) {
+			slot = &slots[i];
+			break;
+		}
+
+		if (!slot || slots[i].used < slot->used) {
+			slot = &slots[i];
+		}
+	}
+
+	if (!slot->hash) {
+		__atomic_fetch_add(&shm->entries, 1, __ATOMIC_RELAXED);
+	} else if (!found && !(shm->ttl && now - slot->stored >= shm->ttl)) {
+		__atomic_fetch_add(&shm->evictions, 1, __ATOMIC_RELAXED);
+	}
+
+	slot->hash = hash;
+	slot->stored = now;
+	slot->used = now;
+	memcpy(&slot->key, key, sizeof(*key));
+	memcpy(&slot->result, result, sizeof(*result));
+	pthread_mutex_unlock(lock);
+}
+
+/**
+ * Look up a scenario in the process cache, then in the shared-memory cache
+ *
+ * @param key Canonical scenario
+ * @param result Set to the cached result on a hit
+ * @return int SUCCESS on a hit, FAILURE on a miss
+ */
+static int php_poker_cache_lookup(const php_poker_cache_key *key, php_poker_cache_result *result)
+{
+	if (php_poker_cache_state.entries && php_poker_cache_get(key, result) == SUCCESS) {
+		return SUCCESS;
+	}
+
+	if (php_poker_shm_cache && php_poker_shm_get(key, result) == SUCCESS) {
+		/* Keep it at hand for this process's next request */
+		if (php_poker_cache_state.entries) {
+			php_poker_cache_put(key, result);
+		}
+
+		return SUCCESS;
+	}
+
+	return FAILURE;
+}
+
+/**
+ * Store a scenario's result in every enabled cache
+ *
+ * @param key Canonical scenario
+ * @param result Result to keep, in key order
+ */
+static void php_poker_cache_store(const php_poker_cache_key *key, const php_poker_cache_result *result)
+{
+	if (php_poker_cache_state.entries) {
+		php_poker_cache_put(key, result);
+	}
+
+	if (php_poker_shm_cache) {
+		php_poker_shm_put(key, result);
+	}
+}
+
+/**
+ * PHP Module globals initialization
+ */
+PHP_GINIT_FUNCTION(phpoker)
+{
+#if defined(COMPILE_DL_PHPOKER) && defined(ZTS)
+	ZEND_TSRMLS_CACHE_UPDATE();
+#endif
+	memset(phpoker_globals, 0, sizeof(*phpoker_globals));
+}
+
+/**
+ * PHP Module initialization
+ */
+PHP_MINIT_FUNCTION(phpoker)
+{
+	REGISTER_INI_ENTRIES();
+
+	php_poker_init_eval_tables();
+	php_poker_init_eval_batch();
+	php_poker_init_combo_tables();
+	php_poker_register_range_class();
+	php_poker_register_calculator_class();
+
+	/* Optional Two Plus Two backend, falls back to the Cactus Kev tables */
+	if (PHPOKER_G(evaluator) && strcasecmp(PHPOKER_G(evaluator), "twoplustwo") == 0) {
+		if (php_poker_tpt_load(PHPOKER_G(lookup_table)) == FAILURE) {
+			zend_error(E_CORE_WARNING, "phpoker: unable to load the Two Plus Two lookup table from \"%s\", using the Cactus Kev evaluator", PHPOKER_G(lookup_table) ? PHPOKER_G(lookup_table) : "");
+		}
+	} else if (PHPOKER_G(evaluator) && *PHPOKER_G(evaluator) && strcasecmp(PHPOKER_G(evaluator), "cactus") != 0) {
+		zend_error(E_CORE_WARNING, "phpoker: unknown evaluator \"%s\", using the Cactus Kev evaluator", PHPOKER_G(evaluator));
+	}
+
+	/* Optional exact heads-up preflop table */
+	if (PHPOKER_G(preflop_table) && *PHPOKER_G(preflop_table) && php_poker_preflop_map(PHPOKER_G(preflop_table)) == FAILURE) {
+		zend_error(E_CORE_WARNING, "phpoker: unable to load the preflop table from \"%s\"", PHPOKER_G(preflop_table));
+	}
+
+	/* Optional equity result cache */
+	if (PHPOKER_G(cache_size) > 0) {
+		php_poker_cache_init(PHPOKER_G(cache_size) < PHP_POKER_CACHE_MAX ? PHPOKER_G(cache_size) : PHP_POKER_CACHE_MAX);
+	}
+
+	/* Optional result cache shared by the processes forked from this one */
+	if (PHPOKER_G(shared_cache_size) > 0 && php_poker_shm_init(PHPOKER_G(shared_cache_size) < PHP_POKER_CACHE_MAX ? PHPOKER_G(shared_cache_size) : PHP_POKER_CACHE_MAX,
+		PHPOKER_G(shared_cache_ttl)) == FAILURE) {
+		zend_error(E_CORE_WARNING, "phpoker: unable to create the shared result cache");
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * PHP Module shutdown
+ */
+PHP_MSHUTDOWN_FUNCTION(phpoker)
+{
+	php_poker_pool_shutdown();
+	php_poker_tpt_unmap();
+	php_poker_preflop_unmap();
+	php_poker_cache_free();
+	php_poker_shm_free();
+
+	UNREGISTER_INI_ENTRIES();
+
+	return SUCCESS;
+}
+
+/**
+ * PHP Module info
+ */
+PHP_MINFO_FUNCTION(phpoker)
+{
+	char buf[64];
+
+	php_info_print_table_start();
+	php_info_print_table_header(2, "phpoker support", "enabled");
+	php_info_print_table_row(2, "Version", PHP_PHPOKER_VERSION);
+	php_info_print_table_row(2, "Author", "Nick Poulos");
+	php_info_print_table_row(2, "Evaluator", php_poker_tpt ? "Two Plus Two (mapped)" : "Cactus Kev");
+	php_info_print_table_row(2, "Preflop table", php_poker_preflop ? "mapped" : "not loaded");
+	php_info_print_table_row(2, "Batch kernel", php_poker_eval_batch_name);
+	php_info_print_table_row(2, "Result cache", php_poker_cache_state.entries ? "enabled" : "disabled");
+	php_info_print_table_row(2, "Shared result cache", php_poker_shm_cache ? "enabled" : "disabled");
+
+	if (php_poker_shm_cache) {
+		snprintf(buf, sizeof(buf), ZEND_LONG_FMT " of " ZEND_LONG_FMT, __atomic_load_n(&php_poker_shm_cache->entries, __ATOMIC_RELAXED),
+			(zend_long)(php_poker_shm_cache->num_sets * PHP_POKER_SHM_WAYS));
+		php_info_print_table_row(2, "Shared cache entries", buf);
+		snprintf(buf, sizeof(buf), ZEND_LONG_FMT, __atomic_load_n(&php_poker_shm_cache->hits, __ATOMIC_RELAXED));
+		php_info_print_table_row(2, "Shared cache hits", buf);
+		snprintf(buf, sizeof(buf), ZEND_LONG_FMT, __atomic_load_n(&php_poker_shm_cache->misses, __ATOMIC_RELAXED));
+		php_info_print_table_row(2, "Shared cache misses", buf);
+		snprintf(buf, sizeof(buf), ZEND_LONG_FMT, __atomic_load_n(&php_poker_shm_cache->evictions, __ATOMIC_RELAXED));
+		php_info_print_table_row(2, "Shared cache evictions", buf);
+	}
+
+	php_info_print_table_end();
+
+	DISPLAY_INI_ENTRIES();
+}
+
+/**
+ * Evaluate a poker hand and return information about it
+ *
+ * This function takes a poker hand, evaluates it, and returns an array
+ * with information about the hand.
+ *
+ * @param string|array|int $hand Card string (e.g. "Ah Kd Qc Js Th"), list of card strings or ids, or card mask
+ * @return array Array with hand information (value, rank, name, cards)
+ */
+PHP_FUNCTION(poker_evaluate_hand)
+{
+	zval *hand_zv;
+	int cards[8]; /* Up to 7 cards, plus one to detect extras */
+	int num_cards;
+	unsigned short eval_result;
+	int hand_type;
+
+	/* Parse function arguments */
+	ZEND_PARSE_PARAMETERS_START(1, 1)
+		Z_PARAM_ZVAL(hand_zv)
+	ZEND_PARSE_PARAMETERS_END();
+
+	/* Read the cards from a string, a list of cards or a card mask */
+	num_cards = php_poker_zval_cards(hand_zv, cards, 7);
+
+	/* Check for invalid cards */
+	if (num_cards == -1) {
+		zend_throw_exception(zend_ce_exception, "Invalid card format in hand", 0);
+		RETURN_NULL();
+	}
+
+	/* Check for correct number of cards */
+	if (num_cards < 5 || num_cards > 7) {
+		zend_throw_exception(zend_ce_exception, "Invalid number of cards (need exactly 5, 6 or 7)", 0);
+		RETURN_NULL();
+	}
+
+	/* The rank lookups only cover hands of distinct cards */
+	if (php_poker_popcount(php_poker_cards_mask(cards, num_cards)) != num_cards) {
+		zend_throw_exception(zend_ce_exception, "Duplicate card found in hand", 0);
+		RETURN_NULL();
+	}
+
+	/* Evaluate the hand */
+	eval_result = php_poker_eval_cards(cards, num_cards);
+
+	/* Get the hand type */
+	hand_type = php_poker_hand_rank(eval_result);
+
+	/* Create return array with hand info */
+	array_init(return_value);
+	add_assoc_long(return_value, "value", eval_result);
+	add_assoc_long(return_value, "rank", hand_type);
+	add_assoc_string(return_value, "name", (char*)php_poker_get_hand_name(hand_type));
+	add_assoc_long(return_value, "cards", num_cards); /* Add card count to output */
+}
+
+/**
+ * Evaluate many poker hands in one call
+ *
+ * Each hand is a card string ("Ah Kh Qh Jh Th"), a list of 5 to 7 card
+ * strings or ids (suit * 13 + rank, suits c, d, h, s), or a card mask. Results come back as two packed
+ * lists in the order of the input instead of one array per hand. The hands
+ * are evaluated by the batch kernel picked for the CPU in MINIT.
+ *
+ * @param array $hands List of hands
+ * @return array ['values' => list of hand values, 'ranks' => list of hand ranks (1-9)]
+ */
+PHP_FUNCTION(poker_evaluate_hands)
+{
+	HashTable *hands_hash;
+	zval *hand_zv;
+	zval values, ranks;
+	int hand[8];
+	int *cards;
+	unsigned char *num_cards;
+	unsigned short *results;
+	uint32_t count, i = 0;
+	int num_hand_cards;
+
+	ZEND_PARSE_PARAMETERS_START(1, 1)
+		Z_PARAM_ARRAY_HT(hands_hash)
+	ZEND_PARSE_PARAMETERS_END();
+
+	count = zend_hash_num_elements(hands_hash);
+
+	/* Parse everything first, then evaluate in one kernel call */
+	cards = safe_emalloc(count, 7 * sizeof(int), 0);
+	num_cards = safe_emalloc(count, 1, 0);
+	results = safe_emalloc(count, sizeof(unsigned short), 0);
+
+	ZEND_HASH_FOREACH_VAL(hands_hash, hand_zv) {
+		ZVAL_DEREF(hand_zv);
+		memset(hand, 0, sizeof(hand)); /* The kernels read all 7 slots */
+		num_hand_cards = php_poker_zval_cards(hand_zv, hand, 7);
+
+		if (num_hand_cards < 5 || num_hand_cards > 7) {
+			efree(cards);
+			efree(num_cards);
+			efree(results);
+			zend_throw_exception(zend_ce_exception, num_hand_cards < 0 ? "Invalid card format in hand" : "Invalid number of cards (need exactly 5, 6 or 7)", 0);
+			RETURN_NULL();
+		}
+
+		if (php_poker_popcount(php_poker_cards_mask(hand, num_hand_cards)) != num_hand_cards) {
+			efree(cards);
+			efree(num_cards);
+			efree(results);
+			zend_throw_exception(zend_ce_exception, "Duplicate card found in hand", 0);
+			RETURN_NULL();
+		}
+
+		memcpy(&cards[i * 7], hand, 7 * sizeof(int));
+		num_cards[i++] = (unsigned char)num_hand_cards;
+	} ZEND_HASH_FOREACH_END();
+
+	php_poker_eval_batch(cards, num_cards, count, results);
+
+	array_init_size(&values, count);
+	array_init_size(&ranks, count);
+	zend_hash_real_init_packed(Z_ARRVAL(values));
+	zend_hash_real_init_packed(Z_ARRVAL(ranks));
+
+	for (i = 0; i < count; i++) {
+		add_next_index_long(&values, results[i]);
+		add_next_index_long(&ranks, php_poker_hand_rank(results[i]));
+	}
+
+	efree(cards);
+	efree(num_cards);
+	efree(results);
+
+	array_init_size(return_value, 2);
+	add_assoc_zval(return_value, "values", &values);
+	add_assoc_zval(return_value, "ranks", &ranks);
+}
+
+/**
+ * Evaluate an Omaha hand
+ *
+ * The hand is the best five cards made of exactly two hole cards and exactly
+ * three board cards, as in Pot-Limit Omaha. The board is combined into its
+ * 3-card subsets once and every pair of hole cards is scored against them.
+ *
+ * @param string|array|int $hole 4 or 5 hole cards: card string, list of card strings or ids, or card mask
+ * @param string|array|int $board 3 to 5 board cards, in the same forms
+ * @return array Array with hand information (value, rank, name, and low: the
+ *               ace-to-five eight-or-better low value, 0 for no low)
+ */
+PHP_FUNCTION(poker_evaluate_omaha)
+{
+	zval *hole_zv, *board_zv;
+	int hole[6], board[6]; /* Up to 5 cards each, plus one to detect extras */
+	int num_hole, num_board;
+	php_poker_omaha_board omaha_board;
+	unsigned short eval_result;
+	int hand_type;
+
+	ZEND_PARSE_PARAMETERS_START(2, 2)
+		Z_PARAM_ZVAL(hole_zv)
+		Z_PARAM_ZVAL(board_zv)
+	ZEND_PARSE_PARAMETERS_END();
+
+	num_hole = php_poker_zval_cards(hole_zv, hole, 5);
+	num_board = php_poker_zval_cards(board_zv, board, 5);
+
+	if (num_hole == -1 || num_board == -1) {
+		zend_throw_exception(zend_ce_exception, "Invalid card format in hand", 0);
+		RETURN_NULL();
+	}
+
+	if (num_hole < 4 || num_hole > 5) {
+		zend_throw_exception(zend_ce_exception, "Invalid number of hole cards (need exactly 4 or 5)", 0);
+		RETURN_NULL();
+	}
+
+	if (num_board < 3 || num_board > 5) {
+		zend_throw_exception(zend_ce_exception, "Invalid number of board cards (need exactly 3, 4 or 5)", 0);
+		RETURN_NULL();
+	}
+
+	if (php_poker_popcount(php_poker_cards_mask(hole, num_hole) | php_poker_cards_mask(board, num_board)) != num_hole + num_board) {
+		zend_throw_exception(zend_ce_exception, "Duplicate card found in hand", 0);
+		RETURN_NULL();
+	}
+
+	php_poker_init_omaha_board(&omaha_board, board, num_board);
+	eval_result = php_poker_eval_omaha_hand(&omaha_board, hole, num_hole);
+	hand_type = php_poker_hand_rank(eval_result);
+
+	array_init(return_value);
+	add_assoc_long(return_value, "value", eval_result);
+	add_assoc_long(return_value, "rank", hand_type);
+	add_assoc_string(return_value, "name", (char*)php_poker_get_hand_name(hand_type));
+	add_assoc_long(return_value, "low", php_poker_eval_omaha_low(&omaha_board, hole, num_hole));
+}
+
+/**
+ * Evaluate a lowball hand
+ *
+ * "ace_five" is the eight-or-better low of hi-lo games such as Stud 8 and
+ * Omaha Hi-Lo: the best five cards of different ranks from ace to eight,
+ * ace low, ignoring straights and flushes. "deuce_seven" is 2-7 lowball:
+ * five cards, aces high, straights and flushes count.
+ *
+ * @param string|array|int $hand Card string, list of card strings or ids, or card mask:
+ *                               5 to 7 cards for ace_five, 5 for deuce_seven
+ * @param string $type "ace_five" (default) or "deuce_seven"
+ * @return array Array with value (lower is better, 0 for no ace-to-five low) and name
+ */
+PHP_FUNCTION(poker_evaluate_low)
+{
+	zval *hand_zv;
+	char *type = "ace_five";
+	size_t type_len;
+	int cards[8]; /* Up to 7 cards, plus one to detect extras */
+	int num_cards, value, hand_type;
+	char low_name[10];
+
+	ZEND_PARSE_PARAMETERS_START(1, 2)
+		Z_PARAM_ZVAL(hand_zv)
+		Z_PARAM_OPTIONAL
+		Z_PARAM_STRING(type, type_len)
+	ZEND_PARSE_PARAMETERS_END();
+
+	if (strcmp(type, "ace_five") != 0 && strcmp(type, "deuce_seven") != 0) {
+		zend_throw_exception(zend_ce_exception, "Invalid lowball type (need ace_five or deuce_seven)", 0);
+		RETURN_NULL();
+	}
+
+	num_cards = php_poker_zval_cards(hand_zv, cards, 7);
+
+	if (num_cards == -1) {
+		zend_throw_exception(zend_ce_exception, "Invalid card format in hand", 0);
+		RETURN_NULL();
+	}
+
+	if (type[0] == 'a' ? num_cards < 5 || num_cards > 7 : num_cards != 5) {
+		zend_throw_exception(zend_ce_exception, type[0] == 'a' ? "Invalid number of cards (need exactly 5, 6 or 7)" : "Invalid number of cards (need exactly 5)", 0);
+		RETURN_NULL();
+	}
+
+	if (php_poker_popcount(php_poker_cards_mask(cards, num_cards)) != num_cards) {
+		zend_throw_exception(zend_ce_exception, "Duplicate card found in hand", 0);
+		RETURN_NULL();
+	}
+
+	array_init(return_value);
+
+	if (type[0] == 'a') {
+		value = php_poker_eval_low(cards, num_cards);
+
+		if (value) {
+			php_poker_low_name(low_name, value);
+		}
+
+		add_assoc_long(return_value, "value", value);
+		add_assoc_string(return_value, "name", value ? low_name : "No Low");
+		return;
+	}
+
+	/* A-5-4-3-2 is ace high, not a straight */
+	if (((cards[0] | cards[1] | cards[2] | cards[3] | cards[4]) >> 16) == PHP_POKER_WHEEL) {
+		hand_type = cards[0] & cards[1] & cards[2] & cards[3] & cards[4] & 0xf000 ? 4 : 9;
+	} else {
+		hand_type = php_poker_hand_rank(php_poker_eval_5hand(cards));
+	}
+
+	add_assoc_long(return_value, "value", php_poker_eval_deuce_seven(cards));
+	add_assoc_string(return_value, "name", (char*)php_poker_get_hand_name(hand_type));
+}
+
+/**
+ * Evaluate a short-deck (6+) hold'em hand
+ *
+ * Cards run from six to ace. Flushes beat full houses and A-6-7-8-9 is the
+ * lowest straight; values use the same 1..7462 scale as poker_evaluate_hand
+ * but only compare with other short-deck values.
+ *
+ * @param string|array|int $hand 5 to 7 cards: card string, list of card strings or ids, or card mask
+ * @return array Array with hand information (value, rank, name, cards)
+ */
+PHP_FUNCTION(poker_evaluate_short_deck)
+{
+	zval *hand_zv;
+	int cards[8]; /* Up to 7 cards, plus one to detect extras */
+	int num_cards, i;
+	unsigned short eval_result;
+	int hand_type;
+
+	ZEND_PARSE_PARAMETERS_START(1, 1)
+		Z_PARAM_ZVAL(hand_zv)
+	ZEND_PARSE_PARAMETERS_END();
+
+	num_cards = php_poker_zval_cards(hand_zv, cards, 7);
+
+	if (num_cards == -1) {
+		zend_throw_exception(zend_ce_exception, "Invalid card format in hand", 0);
+		RETURN_NULL();
+	}
+
+	if (num_cards < 5 || num_cards > 7) {
+		zend_throw_exception(zend_ce_exception, "Invalid number of cards (need exactly 5, 6 or 7)", 0);
+		RETURN_NULL();
+	}
+
+	for (i = 0; i < num_cards; i++) {
+		if (RANK(cards[i]) < 4) {
+			zend_throw_exception(zend_ce_exception, "Short deck has no cards below six", 0);
+			RETURN_NULL();
+		}
+	}
+
+	if (php_poker_popcount(php_poker_cards_mask(cards, num_cards)) != num_cards) {
+		zend_throw_exception(zend_ce_exception, "Duplicate card found in hand", 0);
+		RETURN_NULL();
+	}
+
+	eval_result = php_poker_eval_short_cards(cards, num_cards);
+	hand_type = php_poker_short_hand_rank(eval_result);
+
+	array_init(return_value);
+	add_assoc_long(return_value, "value", eval_result);
+	add_assoc_long(return_value, "rank", hand_type);
+	add_assoc_string(return_value, "name", (char*)php_poker_get_hand_name(hand_type));
+	add_assoc_long(return_value, "cards", num_cards);
+}
+
+/**
+ * Convert cards to card ids
+ *
+ * A card id is suit * 13 + rank, with suits ordered c, d, h, s and ranks
+ * from deuce (0) to ace (12).
+ *
+ * @param string|array|int $cards Card string ("Ah Kd"), list of card strings or ids, or card mask
+ * @return array List of card ids
+ */
+PHP_FUNCTION(poker_cards_to_ids)
+{
+	zval *cards_zv;
+	int cards[53];
+	int num_cards, i;
+
+	ZEND_PARSE_PARAMETERS_START(1, 1)
+		Z_PARAM_ZVAL(cards_zv)
+	ZEND_PARSE_PARAMETERS_END();
+
+	if ((num_cards = php_poker_zval_cards(cards_zv, cards, 52)) < 0 || num_cards > 52) {
+		zend_throw_exception(zend_ce_exception, "Invalid card format", 0);
+		RETURN_NULL();
+	}
+
+	array_init_size(return_value, num_cards);
+
+	for (i = 0; i < num_cards; i++) {
+		add_next_index_long(return_value, php_poker_card_index(cards[i]));
+	}
+}
+
+/**
+ * Convert cards to a 64-bit card mask (bit n set for card id n)
+ *
+ * @param string|array|int $cards Card string ("Ah Kd"), list of card strings or ids, or card mask
+ * @return int Card mask
+ */
+PHP_FUNCTION(poker_cards_to_mask)
+{
+	zval *cards_zv;
+	int cards[53];
+	int num_cards;
+
+	ZEND_PARSE_PARAMETERS_START(1, 1)
+		Z_PARAM_ZVAL(cards_zv)
+	ZEND_PARSE_PARAMETERS_END();
+
+	if ((num_cards = php_poker_zval_cards(cards_zv, cards, 52)) < 0 || num_cards > 52) {
+		zend_throw_exception(zend_ce_exception, "Invalid card format", 0);
+		RETURN_NULL();
+	}
+
+	RETURN_LONG((zend_long)php_poker_cards_mask(cards, num_cards));
+}
+
+/**
+ * Convert cards to a card string
+ *
+ * @param string|array|int $cards Card string, list of card strings or ids, or card mask
+ * @return string Cards separated by spaces (e.g. "Ah Kd")
+ */
+PHP_FUNCTION(poker_cards_to_string)
+{
+	zval *cards_zv;
+	zend_string *result;
+	int cards[53];
+	int num_cards, i;
+
+	ZEND_PARSE_PARAMETERS_START(1, 1)
+		Z_PARAM_ZVAL(cards_zv)
+	ZEND_PARSE_PARAMETERS_END();
+
+	if ((num_cards = php_poker_zval_cards(cards_zv, cards, 52)) < 0 || num_cards > 52) {
+		zend_throw_exception(zend_ce_exception, "Invalid card format", 0);
+		RETURN_NULL();
+	}
+
+	if (num_cards == 0) {
+		RETURN_EMPTY_STRING();
+	}
+
+	result = zend_string_alloc(num_cards * 3 - 1, 0);
+
+	for (i = 0; i < num_cards; i++) {
+		php_poker_card_name(&ZSTR_VAL(result)[i * 3], cards[i]);
+
+		if (i + 1 < num_cards) {
+			ZSTR_VAL(result)[i * 3 + 2] = ' ';
+		}
+	}
+
+	RETURN_NEW_STR(result);
+}
+
+/**
+ * Read the settings of an equity calculation
+ *
+ * @param sc Scenario to fill in (zeroed by the caller)
+ * @param options Options array, or NULL
+ * @return int SUCCESS, or FAILURE with an exception thrown
+ */
+static int php_poker_scenario_options(php_poker_scenario *sc, HashTable *options)
+{
+	zval *option;
+
+	sc->mode = PHP_POKER_MODE_AUTO;
+	sc->threads = PHPOKER_G(threads);
+	sc->use_cache = 1;
+
+	if (options == NULL) {
+		return SUCCESS;
+	}
+
+	if ((option = zend_hash_str_find(options, "precision", sizeof("precision") - 1)) != NULL) {
+		sc->precision = zval_get_double(option);
+
+		if (!(sc->precision > 0.0)) {
+			zend_throw_exception(zend_ce_exception, "Precision must be a positive standard error in percentage points", 0);
+			return FAILURE;
+		}
+	}
+
+	if ((option = zend_hash_str_find(options, "max_time", sizeof("max_time") - 1)) != NULL) {
+		sc->max_time = zval_get_double(option);
+
+		if (!(sc->max_time > 0.0)) {
+			zend_throw_exception(zend_ce_exception, "Max time must be a positive number of seconds", 0);
+			return FAILURE;
+		}
+	}
+
+	if ((option = zend_hash_str_find(options, "mode", sizeof("mode") - 1)) != NULL) {
+		if (Z_TYPE_P(option) != IS_STRING) {
+			zend_throw_exception(zend_ce_exception, "Invalid equity mode (need auto, exact or monte_carlo)", 0);
+			return FAILURE;
+		}
+
+		if (strcmp(Z_STRVAL_P(option), "auto") == 0) {
+			sc->mode = PHP_POKER_MODE_AUTO;
+		} else if (strcmp(Z_STRVAL_P(option), "exact") == 0) {
+			sc->mode = PHP_POKER_MODE_EXACT;
+		} else if (strcmp(Z_STRVAL_P(option), "monte_carlo") == 0) {
+			sc->mode = PHP_POKER_MODE_MONTE_CARLO;
+		} else {
+			zend_throw_exception(zend_ce_exception, "Invalid equity mode (need auto, exact or monte_carlo)", 0);
+			return FAILURE;
+		}
+	}
+
+	if ((option = zend_hash_str_find(options, "game", sizeof("game") - 1)) != NULL
+		&& (sc->eq.game = php_poker_parse_game(option)) < 0) {
+		zend_throw_exception(zend_ce_exception, "Invalid game (need holdem, omaha, omaha5 or shortdeck)", 0);
+		return FAILURE;
+	}
+
+	if ((option = zend_hash_str_find(options, "hilo", sizeof("hilo") - 1)) != NULL) {
+		sc->eq.hilo = zend_is_true(option);
+	}
+
+	if ((option = zend_hash_str_find(options, "threads", sizeof("threads") - 1)) != NULL) {
+		sc->threads = zval_get_long(option);
+	}
+
+	if ((option = zend_hash_str_find(options, "seed", sizeof("seed") - 1)) != NULL) {
+		sc->seed = (uint64_t)zval_get_long(option);
+		sc->has_seed = 1;
+	}
+
+	if ((option = zend_hash_str_find(options, "combos", sizeof("combos") - 1)) != NULL) {
+		sc->combo_results = zend_is_true(option);
+	}
+
+	if ((option = zend_hash_str_find(options, "categories", sizeof("categories") - 1)) != NULL) {
+		sc->eq.categories = zend_is_true(option);
+	}
+
+	if ((option = zend_hash_str_find(options, "cache", sizeof("cache") - 1)) != NULL) {
+		sc->use_cache = zend_is_true(option);
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * Read and check the players, board and dead cards of an equity calculation
+ *
+ * Hand ranges are parsed here, once; their combos are only dealt out
+ * against the cards in play when the scenario is calculated.
+ *
+ * @param sc Scenario with its options read
+ * @param hole_cards Each player's hole cards or hand range
+ * @param board_cards Board cards (list or card mask), or NULL
+ * @param dead_cards Dead cards (list or card mask), or NULL
+ * @return int SUCCESS, or FAILURE with an exception thrown
+ */
+static int php_poker_scenario_cards(php_poker_scenario *sc, HashTable *hole_cards, zval *board_cards, zval *dead_cards)
+{
+	php_poker_equity *eq = &sc->eq;
+	zval *hole_cards_item;
+	int num_hole_cards = php_poker_game_hole_cards[eq->game];
+	int cards[6];
+	int board_count = 0;
+	int hole_count;
+	int unknown;
+	int i = 0;
+	uint64_t card_mask;
+
+	/* Get board cards if provided: a list of cards or a card mask */
+	if (board_cards != NULL && Z_TYPE_P(board_cards) != IS_NULL) {
+		if (Z_TYPE_P(board_cards) != IS_ARRAY && Z_TYPE_P(board_cards) != IS_LONG) {
+			zend_throw_exception(zend_ce_exception, "Board cards must be an array or a card mask", 0);
+			return FAILURE;
+		}
+
+		board_count = php_poker_zval_cards(board_cards, cards, 5);
+
+		if (board_count < 0) {
+			zend_throw_exception(zend_ce_exception, "Invalid board card format", 0);
+			return FAILURE;
+		}
+
+		/* Ensure we don't have too many board cards */
+		if (board_count > 5) {
+			zend_throw_exception(zend_ce_exception, "Board cannot have more than 5 cards", 0);
+			return FAILURE;
+		}
+
+		memcpy(eq->board, cards, sizeof(int) * board_count);
+	}
+
+	/* Get dead cards if provided: a list of cards or a card mask */
+	if (dead_cards != NULL && Z_TYPE_P(dead_cards) != IS_NULL) {
+		if (Z_TYPE_P(dead_cards) != IS_ARRAY && Z_TYPE_P(dead_cards) != IS_LONG) {
+			zend_throw_exception(zend_ce_exception, "Dead cards must be an array or a card mask", 0);
+			return FAILURE;
+		}
+
+		sc->dead_count = php_poker_zval_cards(dead_cards, sc->dead_cards, 52);
+
+		if (sc->dead_count < 0) {
+			zend_throw_exception(zend_ce_exception, "Invalid dead card format", 0);
+			return FAILURE;
+		}
+	}
+
+	if (eq->hilo && eq->game == PHP_POKER_GAME_SHORTDECK) {
+		zend_throw_exception(zend_ce_exception, "Hi-lo is not played with a short deck", 0);
+		return FAILURE;
+	}
+
+	/* Parse the hole cards for each player */
+	ZEND_HASH_FOREACH_VAL(hole_cards, hole_cards_item) {
+		if (i >= 10) {
+			break; /* Limit to 10 players for sanity */
+		}
+
+		if (Z_TYPE_P(hole_cards_item) == IS_OBJECT && instanceof_function(Z_OBJCE_P(hole_cards_item), php_poker_range_ce)) {
+			if (num_hole_cards != 2) {
+				zend_throw_exception(zend_ce_exception, "Hand ranges are only supported in hold'em", 0);
+				return FAILURE;
+			}
+
+			sc->weights[i] = emalloc(sizeof(double) * PHP_POKER_COMBOS);
+			php_poker_range_weights(php_poker_range_from_obj(Z_OBJ_P(hole_cards_item)), sc->weights[i]);
+			eq->num_ranges++;
+			i++;
+			continue;
+		}
+
+		if (Z_TYPE_P(hole_cards_item) != IS_STRING && Z_TYPE_P(hole_cards_item) != IS_ARRAY && Z_TYPE_P(hole_cards_item) != IS_LONG) {
+			zend_throw_exception(zend_ce_exception, "Hole cards must be strings, card lists, card masks or PHPoker\\Range objects", 0);
+			return FAILURE;
+		}
+
+		hole_count = php_poker_zval_hole_cards(hole_cards_item, cards, num_hole_cards, &unknown);
+
+		/* A string that is not a list of cards is read as a hand range */
+		if (hole_count < 0 && Z_TYPE_P(hole_cards_item) == IS_STRING && num_hole_cards == 2) {
+			sc->weights[i] = emalloc(sizeof(double) * PHP_POKER_COMBOS);
+
+			if (php_poker_parse_range(Z_STRVAL_P(hole_cards_item), sc->weights[i]) == FAILURE) {
+				zend_throw_exception(zend_ce_exception, "Invalid hand range", 0);
+				return FAILURE;
+			}
+
+			eq->num_ranges++;
+			i++;
+			continue;
+		}
+
+		if (hole_count < 0) {
+			zend_throw_exception(zend_ce_exception, "Invalid hole card format", 0);
+			return FAILURE;
+		}
+
+		if (hole_count != num_hole_cards) {
+			zend_throw_exception(zend_ce_exception, num_hole_cards == 2 ? "Each player must have exactly 2 hole cards"
+				: num_hole_cards == 4 ? "Each player must have exactly 4 hole cards" : "Each player must have exactly 5 hole cards", 0);
+			return FAILURE;
+		}
+
+		/* Unknown cards take the last slots and are dealt with the board */
+		memcpy(eq->player_hands[i], cards, sizeof(int) * (num_hole_cards - unknown));
+		eq->unknown[i] = unknown;
+		eq->num_unknown += unknown;
+
+		/* Check for duplicates within and between players */
+		card_mask = php_poker_cards_mask(cards, num_hole_cards - unknown);
+
+		if ((sc->used & card_mask) || php_poker_popcount(card_mask) != num_hole_cards - unknown) {
+			zend_throw_exception(zend_ce_exception, "Duplicate hole card found", 0);
+			return FAILURE;
+		}
+
+		sc->used |= card_mask;
+
+		i++;
+	} ZEND_HASH_FOREACH_END();
+
+	eq->num_players = i; /* In case we hit the 10 player limit */
+
+	/* Check the board cards */
+	eq->board_count = board_count;
+	card_mask = php_poker_cards_mask(eq->board, board_count);
+
+	if ((sc->used & card_mask) || php_poker_popcount(card_mask) != board_count) {
+		zend_throw_exception(zend_ce_exception, "Duplicate card found on board", 0);
+		return FAILURE;
+	}
+
+	sc->used |= card_mask;
+
+	/* Check the dead cards */
+	if (sc->dead_count > 52) {
+		zend_throw_exception(zend_ce_exception, "Too many used cards in play", 0);
+		return FAILURE;
+	}
+
+	card_mask = php_poker_cards_mask(sc->dead_cards, sc->dead_count);
+
+	if ((sc->used & card_mask) || php_poker_popcount(card_mask) != sc->dead_count) {
+		zend_throw_exception(zend_ce_exception, "Dead card already in use by player or on board", 0);
+		return FAILURE;
+	}
+
+	sc->used |= card_mask;
+
+	/* A short deck has no deuces through fives: deal as if they were dead */
+	if (eq->game == PHP_POKER_GAME_SHORTDECK) {
+		if (sc->used & ~PHP_POKER_SHORT_DECK_MASK) {
+			zend_throw_exception(zend_ce_exception, "Short deck has no cards below six", 0);
+			return FAILURE;
+		}
+
+		sc->used |= PHP_POKER_DECK_MASK & ~PHP_POKER_SHORT_DECK_MASK;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * Release the hand ranges of a scenario
+ *
+ * @param sc Scenario
+ */
+static void php_poker_scenario_free(php_poker_scenario *sc)
+{
+	int i;
+
+	for (i = 0; i < 10; i++) {
+		if (sc->weights[i]) {
+			efree(sc->weights[i]);
+			sc->weights[i] = NULL;
+		}
+	}
+}
+
+/**
+ * Build the per-player results of an equity calculation
+ *
+ * @param sc Scenario with the settings asked for
+ * @param eq Counters of the calculation
+ * @param total Number of boards the counters are out of
+ * @param mode PHP_POKER_MODE_* that produced the counters
+ * @param return_value Receives the results
+ */
+static void php_poker_scenario_result(const php_poker_scenario *sc, const php_poker_equity *eq, zend_long total, int mode, zval *return_value)
+{
+	double equity[10] = {0.0}; /* Equity percentage for each player */
+	double error;
+	char combo_name[5];
+	int i, j;
+
+	/* Calculate equity percentages: the share of the pot each player wins */
+	for (i = 0; i < eq->num_players; i++) {
+		if (eq->hilo) {
+			equity[i] = (double)eq->shares[i] / PHP_POKER_POT_UNITS / total * 100.0;
+		} else {
+			equity[i] = (double)(eq->wins[i] + (eq->ties[i] / (double)2)) / total * 100.0;
+		}
+	}
+
+	/* Return the results */
+	array_init(return_value);
+
+	for (i = 0; i < eq->num_players; i++) {
+		zval player_result;
+		array_init(&player_result);
+
+		add_assoc_double(&player_result, "equity", equity[i]);
+		add_assoc_long(&player_result, "wins", eq->wins[i]);
+		add_assoc_long(&player_result, "ties", eq->ties[i]);
+
+		/* Exact and table results have no sampling error */
+		if (sc->precision > 0.0 || sc->max_time > 0.0) {
+			zval interval;
+			error = mode == PHP_POKER_MODE_MONTE_CARLO ? php_poker_std_error(eq, i, total) : 0.0;
+
+			array_init_size(&interval, 2);
+			add_next_index_double(&interval, equity[i] - 1.96 * error > 0.0 ? equity[i] - 1.96 * error : 0.0);
+			add_next_index_double(&interval, equity[i] + 1.96 * error < 100.0 ? equity[i] + 1.96 * error : 100.0);
+
+			add_assoc_long(&player_result, "iterations", total);
+			add_assoc_double(&player_result, "std_error", error);
+			add_assoc_zval(&player_result, "ci", &interval);
+		}
+
+		if (eq->hilo) {
+			add_assoc_long(&player_result, "scoops", eq->scoops[i]);
+			add_assoc_long(&player_result, "high_only", eq->high_only[i]);
+			add_assoc_long(&player_result, "low_only", eq->low_only[i]);
+			add_assoc_long(&player_result, "partial_scoops", eq->partial_scoops[i]);
+		}
+
+		/* Boards ending in each hand category, and those won with it */
+		if (eq->categories) {
+			zval categories;
+			array_init_size(&categories, 9);
+
+			for (j = 0; j < 9; j++) {
+				zval category;
+				array_init_size(&category, 2);
+				add_assoc_long(&category, "hands", eq->hand_counts[i][j]);
+				add_assoc_long(&category, "wins", eq->win_counts[i][j]);
+				add_assoc_zval(&categories, php_poker_get_hand_name(j + 1), &category);
+			}
+
+			add_assoc_zval(&player_result, "categories", &categories);
+		}
+
+		/* Equity of each combo of a hand range, out of the times it was dealt */
+		if (eq->combo_stats && eq->ranges[i]) {
+			zval combos;
+			array_init(&combos);
+
+			for (j = 0; j < eq->ranges[i]->count; j++) {
+				zend_long (*stats)[3] = &eq->combo_stats[eq->ranges[i]->first + j];
+				zval combo_result;
+				array_init(&combo_result);
+
+				if (eq->hilo) {
+					add_assoc_double(&combo_result, "equity", (*stats)[2] > 0 ? (*stats)[0] / (double)PHP_POKER_POT_UNITS / (*stats)[2] * 100.0 : 0.0);
+				} else {
+					add_assoc_double(&combo_result, "equity", (*stats)[2] > 0 ? ((*stats)[0] + (*stats)[1] / (double)2) / (*stats)[2] * 100.0 : 0.0);
+				}
+				add_assoc_long(&combo_result, "deals", (*stats)[2]);
+
+				php_poker_combo_name(combo_name, eq->ranges[i]->cards[j][0], eq->ranges[i]->cards[j][1]);
+				add_assoc_zval(&combos, combo_name, &combo_result);
+			}
+
+			add_assoc_zval(&player_result, "combos", &combos);
+		}
+
+		add_next_index_zval(return_value, &player_result);
+	}
+}
+
+/**
+ * Iteration count of a calculation: with a target precision or time budget
+ * the iterations are only a ceiling, by default the highest allowed
+ *
+ * @param sc Scenario
+ * @param iterations Iterations asked for, 0 or less for the default
+ * @return zend_long Iterations to run
+ */
+static zend_long php_poker_scenario_iterations(const php_poker_scenario *sc, zend_long iterations)
+{
+	if (iterations <= 0) {
+		return sc->precision > 0.0 || sc->max_time > 0.0 ? 1000000 : 10000; /* Default to 10,000 if invalid */
+	}
+
+	return iterations > 1000000 ? 1000000 : iterations; /* Cap at 1,000,000 for performance */
+}
+
+/**
+ * Calculate the equity of a scenario
+ *
+ * The scenario itself is left untouched, so it can be calculated again
+ * after more cards are added to it.
+ *
+ * @param sc Scenario
+ * @param iterations Iterations asked for, 0 or less for the default
+ * @param return_value Receives the per-player results
+ * @return int SUCCESS, or FAILURE with an exception thrown
+ */
+static int php_poker_scenario_calculate(php_poker_scenario *sc, zend_long iterations, zval *return_value)
+{
+	php_poker_equity eq = sc->eq; /* Hole cards and board, with zeroed counters */
+	zend_long total;              /* Number of boards the counters are out of */
+	zend_long threads = sc->threads;
+	uint64_t seed = sc->has_seed ? sc->seed : php_poker_random_seed();
+	uint64_t deadline = 0;
+	int remaining_board_count = 5 - eq.board_count;
+	int remaining_deck_count;
+	int mode = sc->mode;
+	int num_combos = 0;
+	int deck[52];                 /* Remaining cards in the deck */
+	int i, j;
+	php_poker_range *ranges = NULL;
+	php_poker_cache_key cache_key;
+	php_poker_cache_result cache_result;
+	int cache_order[10];          /* Player of each slot of the cache key */
+	int use_cache;
+	int cached = 0;
+
+	/* The budget covers the whole call, not just the simulation */
+	if (sc->max_time > 0.0) {
+		deadline = php_poker_clock() + (uint64_t)(sc->max_time * 1e9);
+	}
+
+	iterations = php_poker_scenario_iterations(sc, iterations);
+
+	/* Check for reasonable thread count */
+	if (threads <= 0) {
+		threads = 1;
+	} else if (threads > PHP_POKER_MAX_THREADS) {
+		threads = PHP_POKER_MAX_THREADS;
+	}
+
+	if (php_poker_popcount(sc->used) + remaining_board_count + 2 * eq.num_ranges + eq.num_unknown > 52) {
+		zend_throw_exception(zend_ce_exception, "Not enough cards left in deck after removing used/dead cards", 0);
+		return FAILURE;
+	}
+
+	/* Prepare the deck (remove all used cards) */
+	remaining_deck_count = php_poker_prepare_deck(deck, sc->used);
+
+	/* Check if we have enough cards left */
+	if (remaining_deck_count < remaining_board_count + eq.num_unknown) {
+		zend_throw_exception(zend_ce_exception, "Not enough cards left in deck after removing used/dead cards", 0);
+		return FAILURE;
+	}
+
+	/* Unknown hole cards are dealt along with the board, so they are sampled */
+	if (eq.num_unknown > 0) {
+		if (mode == PHP_POKER_MODE_EXACT) {
+			zend_throw_exception(zend_ce_exception, "Exact mode does not support unknown hole cards", 0);
+			return FAILURE;
+		}
+
+		mode = PHP_POKER_MODE_MONTE_CARLO;
+	}
+
+	/* Hand ranges lose the combos that use cards already in play */
+	if (eq.num_ranges > 0) {
+		if (mode == PHP_POKER_MODE_EXACT) {
+			zend_throw_exception(zend_ce_exception, "Exact mode does not support hand ranges", 0);
+			return FAILURE;
+		}
+
+		mode = PHP_POKER_MODE_MONTE_CARLO;
+
+		ranges = emalloc(sizeof(php_poker_range) * eq.num_ranges);
+
+		for (i = 0, j = 0; i < eq.num_players; i++) {
+			if (!sc->weights[i]) {
+				continue;
+			}
+
+			if (php_poker_build_range(&ranges[j], sc->weights[i], sc->used) == 0) {
+				efree(ranges);
+				zend_throw_exception(zend_ce_exception, "Hand range has no combos left after card removal", 0);
+				return FAILURE;
+			}
+
+			ranges[j].first = num_combos;
+			num_combos += ranges[j].count;
+			eq.ranges[i] = &ranges[j++];
+		}
+
+		if (sc->combo_results) {
+			eq.combo_stats = ecalloc(num_combos, sizeof(*eq.combo_stats));
+		}
+	}
+
+	/* With the Two Plus Two backend, walk each player's known cards once */
+	if (php_poker_tpt && eq.game == PHP_POKER_GAME_HOLDEM) {
+		for (j = 0; j < eq.num_players; j++) {
+			if (eq.ranges[j] || eq.unknown[j]) {
+				continue; /* Walked when the hand is dealt */
+			}
+
+			eq.tpt_states[j] = php_poker_tpt_walk(PHP_POKER_TPT_START, eq.player_hands[j], 2);
+			eq.tpt_states[j] = php_poker_tpt_walk(eq.tpt_states[j], eq.board, eq.board_count);
+		}
+	}
+
+	/* Enumerate every board when that is no more work than sampling */
+	total = php_poker_choose(remaining_deck_count, remaining_board_count);
+
+	/* Heads-up preflop without dead cards has an exact, precomputed answer */
+	if (mode != PHP_POKER_MODE_MONTE_CARLO && eq.game == PHP_POKER_GAME_HOLDEM && !eq.hilo && !eq.categories && eq.num_players == 2
+		&& eq.board_count == 0 && sc->dead_count == 0 && eq.num_ranges == 0 && php_poker_preflop_lookup(&eq) == SUCCESS) {
+		mode = PHP_POKER_MODE_TABLE;
+	} else if (mode == PHP_POKER_MODE_AUTO) {
+		mode = (total <= PHPOKER_G(exact_threshold) || total <= iterations) ? PHP_POKER_MODE_EXACT : PHP_POKER_MODE_MONTE_CARLO;
+	}
+
+	/* Scenarios seen before, up to suit renaming and player order, come from
+	 * the result cache. Ranges, unknown hole cards, time budgets and categories
+	 * are always calculated, and so are seeded simulations, whose samples
+	 * change when the suits are renamed.
+	 */
+	use_cache = sc->use_cache && (php_poker_cache_state.entries || php_poker_shm_cache) && mode != PHP_POKER_MODE_TABLE
+		&& eq.num_ranges == 0 && eq.num_unknown == 0 && sc->max_time == 0.0 && !eq.categories
+		&& !(mode == PHP_POKER_MODE_MONTE_CARLO && sc->has_seed);
+
+	if (use_cache) {
+		php_poker_cache_key_init(&cache_key, &eq, php_poker_cards_mask(sc->dead_cards, sc->dead_count), cache_order);
+		cache_key.mode = mode;
+
+		if (mode == PHP_POKER_MODE_MONTE_CARLO) {
+			cache_key.iterations = iterations;
+			cache_key.precision = sc->precision;
+		}
+
+		if (php_poker_cache_lookup(&cache_key, &cache_result) == SUCCESS) {
+			php_poker_cache_restore(&eq, &cache_result, cache_order);
+			total = cache_result.total;
+			cached = 1;
+		}
+	}
+
+	if (cached) {
+		/* Counters were filled in from the cache */
+	} else if (mode == PHP_POKER_MODE_TABLE) {
+		/* Counters were filled in from the table */
+	} else if (mode == PHP_POKER_MODE_EXACT) {
+		php_poker_enumerate_boards(&eq, deck, remaining_deck_count, sc->dead_cards, sc->dead_count);
+	} else {
+		total = iterations;
+
+		if (php_poker_simulate(&eq, deck, remaining_deck_count, &total, seed, (int)threads, num_combos, sc->precision, deadline) == FAILURE) {
+			if (eq.combo_stats) {
+				efree(eq.combo_stats);
+			}
+
+			efree(ranges);
+			zend_throw_exception(zend_ce_exception, "Unable to deal the hand ranges without card conflicts", 0);
+			return FAILURE;
+		}
+	}
+
+	if (use_cache && !cached) {
+		php_poker_cache_save(&cache_result, &eq, cache_order, total);
+		php_poker_cache_store(&cache_key, &cache_result);
+	}
+
+	php_poker_scenario_result(sc, &eq, total, mode, return_value);
+
+	if (eq.combo_stats) {
+		efree(eq.combo_stats);
+	}
+
+	if (ranges) {
+		efree(ranges);
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * Calculate equity percentages for multiple poker hands
+ *
+ * This function simulates many poker hands to determine the equity (winning percentage)
+ * for each player in various situations.
+ *
+ * @param array $hole_cards Array of strings representing each player's hole cards, or a hand
+ *                          range such as "QQ+, AKs, T9s-76s, AhKh:0.5" or PHPoker\Range (Monte Carlo only).
+ *                          "??" stands for a hole card dealt at random with the board ("Ah ??",
+ *                          "?? ??"; Monte Carlo only)
+ * @param array $board_cards Optional array of strings representing the board cards
+ * @param int $iterations Optional number of iterations to run (default: 10000), or the most
+ *                        to run with the precision or max_time option (default: 1000000)
+ * @param array $dead_cards Optional array of strings representing cards that are no longer in the deck
+ * @param array $options Optional settings:
+ *                       - mode: "auto" (default), "exact" or "monte_carlo". Auto enumerates every
+ *                         remaining board when there are no more of them than iterations or
+ *                         phpoker.exact_threshold, and samples otherwise. Heads-up preflop
+ *                         calls are answered from phpoker.preflop_table when it is loaded,
+ *                         unless monte_carlo is asked for
+ *                       - game: "holdem" (default), "omaha" (4 hole cards), "omaha5" (5 hole
+ *                         cards) or "shortdeck" (hold'em with the 36 cards from six to ace).
+ *                         Omaha hands use exactly two hole cards and three board cards
+ *                       - hilo: split each pot between the best high hand and the best
+ *                         ace-to-five eight-or-better low (not with shortdeck). Adds scoops,
+ *                         high_only, low_only and partial_scoops board counts to each
+ *                         player's result
+ *                       - precision: target standard error of every player's equity, in
+ *                         percentage points. Monte Carlo runs in rounds and stops as soon as
+ *                         all players are within it. Adds iterations, std_error and a 95%
+ *                         confidence interval (ci) to each player's result
+ *                       - max_time: time budget in seconds. Monte Carlo starts no new chunk
+ *                         of iterations once it is spent and returns the result so far,
+ *                         with the same iterations, std_error and ci keys as precision
+ *                       - threads: number of threads for Monte Carlo (default: phpoker.threads)
+ *                       - seed: integer seed, for reproducible Monte Carlo results
+ *                       - combos: true to add each range combo's equity to the results
+ *                       - categories: true to add, for each hand category, how many boards
+ *                         each player ends with it and how many of those their hand is the
+ *                         best high hand, alone or tied
+ *                       - cache: false to bypass the result cache (see phpoker.cache_size).
+ *                         Cached results are shared by scenarios that only differ by suit
+ *                         renaming or player order; ranges, max_time and categories are
+ *                         never cached
+ * @return array Array with equity information for each player
+ */
+PHP_FUNCTION(poker_calculate_equity)
+{
+	zval *hole_cards_array, *board_cards_array = NULL, *dead_cards_array = NULL, *options_array = NULL;
+	zend_long iterations = 10000;
+	php_poker_scenario sc;   /* Players, cards and settings */
+
+	ZEND_PARSE_PARAMETERS_START(1, 5)
+		Z_PARAM_ARRAY(hole_cards_array)
+		Z_PARAM_OPTIONAL
+		Z_PARAM_ZVAL(board_cards_array)
+		Z_PARAM_LONG(iterations)
+		Z_PARAM_ZVAL(dead_cards_array)
+		Z_PARAM_ARRAY_OR_NULL(options_array)
+	ZEND_PARSE_PARAMETERS_END();
+
+	/* Check if we have at least 2 players */
+	if (zend_hash_num_elements(Z_ARRVAL_P(hole_cards_array)) < 2) {
+		zend_throw_exception(zend_ce_exception, "At least 2 players needed for equity calculation", 0);
+		RETURN_NULL();
+	}
+
+	memset(&sc, 0, sizeof(sc));
+
+	if (php_poker_scenario_options(&sc, options_array != NULL && Z_TYPE_P(options_array) == IS_ARRAY ? Z_ARRVAL_P(options_array) : NULL) == FAILURE
+		|| php_poker_scenario_cards(&sc, Z_ARRVAL_P(hole_cards_array), board_cards_array, dead_cards_array) == FAILURE
+		|| php_poker_scenario_calculate(&sc, iterations, return_value) == FAILURE) {
+		php_poker_scenario_free(&sc);
+		RETURN_NULL();
+	}
+
+	php_poker_scenario_free(&sc);
+}
+
+/**
+ * Break a flop or turn spot down by the next card
+ *
+ * Gives every player's equity for each card that can come next, and each
+ * player's outs, from one pass over the remaining deck. On the flop each
+ * row holds the exact equity once that turn card is out, over every river.
+ *
+ * @param array $hole_cards Each player's hole cards (card strings, card lists or card masks)
+ * @param array|int $board_cards The 3 or 4 board cards
+ * @param array|int $dead_cards Optional cards that are no longer in the deck
+ * @param array $options Optional settings:
+ *                       - game: "holdem" (default), "omaha", "omaha5" or "shortdeck"
+ * @return array ['cards' => the next cards, 'equity' => each card's row of player equities in
+ *               percent, 'outs' => card mask per player of the cards that put them ahead alone]
+ */
+PHP_FUNCTION(poker_calculate_runouts)
+{
+	zval *hole_cards_array, *board_cards_zv, *dead_cards_zv = NULL, *options_array = NULL;
+	zval *hole_cards_item, *option;
+	zval cards, equities, outs_list;
+	int game = PHP_POKER_GAME_HOLDEM;
+	int num_hole_cards, hole_count, num_players = 0;
+	int board_count, dead_count = 0, num_cards, i, j;
+	int hole_cards[6], board_cards[6], dead_cards[53];
+	int deck[52];
+	uint64_t used = 0, card_mask;
+	uint64_t outs[10];
+	zend_long (*shares)[10];
+	char name[3];
+	php_poker_equity eq;
+
+	ZEND_PARSE_PARAMETERS_START(2, 4)
+		Z_PARAM_ARRAY(hole_cards_array)
+		Z_PARAM_ZVAL(board_cards_zv)
+		Z_PARAM_OPTIONAL
+		Z_PARAM_ZVAL(dead_cards_zv)
+		Z_PARAM_ARRAY_OR_NULL(options_array)
+	ZEND_PARSE_PARAMETERS_END();
+
+	if (options_array != NULL && (option = zend_hash_str_find(Z_ARRVAL_P(options_array), "game", sizeof("game") - 1)) != NULL
+		&& (game = php_poker_parse_game(option)) < 0) {
+		zend_throw_exception(zend_ce_exception, "Invalid game (need holdem, omaha, omaha5 or shortdeck)", 0);
+		RETURN_NULL();
+	}
+
+	memset(&eq, 0, sizeof(eq));
+	eq.game = game;
+	num_hole_cards = php_poker_game_hole_cards[game];
+
+	ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(hole_cards_array), hole_cards_item) {
+		if (num_players >= 10) {
+			break; /* Limit to 10 players for sanity */
+		}
+
+		hole_count = php_poker_zval_cards(hole_cards_item, hole_cards, num_hole_cards);
+
+		if (hole_count < 0) {
+			zend_throw_exception(zend_ce_exception, "Invalid hole card format", 0);
+			RETURN_NULL();
+		}
+
+		if (hole_count != num_hole_cards) {
+			zend_throw_exception(zend_ce_exception, num_hole_cards == 2 ? "Each player must have exactly 2 hole cards"
+				: num_hole_cards == 4 ? "Each player must have exactly 4 hole cards" : "Each player must have exactly 5 hole cards", 0);
+			RETURN_NULL();
+		}
+
+		card_mask = php_poker_cards_mask(hole_cards, num_hole_cards);
+
+		if ((used & card_mask) || php_poker_popcount(card_mask) != num_hole_cards) {
+			zend_throw_exception(zend_ce_exception, "Duplicate hole card found", 0);
+			RETURN_NULL();
+		}
+
+		used |= card_mask;
+		memcpy(eq.player_hands[num_players++], hole_cards, sizeof(int) * num_hole_cards);
+	} ZEND_HASH_FOREACH_END();
+
+	if (num_players < 2) {
+		zend_throw_exception(zend_ce_exception, "At least 2 players needed for equity calculation", 0);
+		RETURN_NULL();
+	}
+
+	eq.num_players = num_players;
+
+	/* A flop or a turn */
+	board_count = php_poker_zval_cards(board_cards_zv, board_cards, 5);
+
+	if (board_count < 0) {
+		zend_throw_exception(zend_ce_exception, "Invalid board card format", 0);
+		RETURN_NULL();
+	}
+
+	if (board_count != 3 && board_count != 4) {
+		zend_throw_exception(zend_ce_exception, "Runouts need a flop or a turn (3 or 4 board cards)", 0);
+		RETURN_NULL();
+	}
+
+	card_mask = php_poker_cards_mask(board_cards, board_count);
+
+	if ((used & card_mask) || php_poker_popcount(card_mask) != board_count) {
+		zend_throw_exception(zend_ce_exception, "Duplicate card found on board", 0);
+		RETURN_NULL();
+	}
+
+	used |= card_mask;
+	memcpy(eq.board, board_cards, sizeof(int) * board_count);
+	eq.board_count = board_count;
+
+	if (dead_cards_zv != NULL && Z_TYPE_P(dead_cards_zv) != IS_NULL) {
+		dead_count = php_poker_zval_cards(dead_cards_zv, dead_cards, 52);
+
+		if (dead_count < 0 || dead_count > 52) {
+			zend_throw_exception(zend_ce_exception, "Invalid dead card format", 0);
+			RETURN_NULL();
+		}
+	}
+
+	card_mask = php_poker_cards_mask(dead_cards, dead_count);
+
+	if ((used & card_mask) || php_poker_popcount(card_mask) != dead_count) {
+		zend_throw_exception(zend_ce_exception, "Dead card already in use by player or on board", 0);
+		RETURN_NULL();
+	}
+
+	used |= card_mask;
+
+	if (game == PHP_POKER_GAME_SHORTDECK) {
+		if (used & ~PHP_POKER_SHORT_DECK_MASK) {
+			zend_throw_exception(zend_ce_exception, "Short deck has no cards below six", 0);
+			RETURN_NULL();
+		}
+
+		used |= PHP_POKER_DECK_MASK & ~PHP_POKER_SHORT_DECK_MASK;
+	}
+
+	num_cards = php_poker_prepare_deck(deck, used);
+
+	if (num_cards < 5 - board_count) {
+		zend_throw_exception(zend_ce_exception, "Not enough cards left in deck after removing used/dead cards", 0);
+		RETURN_NULL();
+	}
+
+	shares = safe_emalloc(num_cards, sizeof(*shares), 0);
+	php_poker_runouts(&eq, deck, num_cards, shares, NULL, NULL, outs);
+
+	/* One row per next card, out of the boards that can follow it */
+	array_init_size(&cards, num_cards);
+	array_init_size(&equities, num_cards);
+
+	for (i = 0; i < num_cards; i++) {
+		zval row;
+		array_init_size(&row, num_players);
+
+		for (j = 0; j < num_players; j++) {
+			add_next_index_double(&row, (double)shares[i][j] / PHP_POKER_POT_UNITS / (board_count == 3 ? num_cards - 1 : 1) * 100.0);
+		}
+
+		php_poker_card_name(name, deck[i]);
+		add_next_index_string(&cards, name);
+		add_next_index_zval(&equities, &row);
+	}
+
+	array_init_size(&outs_list, num_players);
+
+	for (j = 0; j < num_players; j++) {
+		add_next_index_long(&outs_list, (zend_long)outs[j]);
+	}
+
+	efree(shares);
+
+	array_init(return_value);
+	add_assoc_zval(return_value, "cards", &cards);
+	add_assoc_zval(return_value, "equity", &equities);
+	add_assoc_zval(return_value, "outs", &outs_list);
+}
+
+/**
+ * Generate the Two Plus Two lookup table file
+ *
+ * Builds the ~130 MB state table used by the "twoplustwo" evaluator backend
+ * and writes it to the given path. Point phpoker.lookup_table at the file and
+ * set phpoker.evaluator=twoplustwo to have it mapped at startup.
+ *
+ * @param string $path File to write
+ * @return bool True on success
+ */
+PHP_FUNCTION(poker_generate_lookup_table)
+{
+	char *path;
+	size_t path_len;
+
+	ZEND_PARSE_PARAMETERS_START(1, 1)
+		Z_PARAM_PATH(path, path_len)
+	ZEND_PARSE_PARAMETERS_END();
+
+	if (php_check_open_basedir(path)) {
+		RETURN_FALSE;
+	}
+
+	if (php_poker_tpt_generate(path) == FAILURE) {
+		zend_throw_exception(zend_ce_exception, "Unable to write the lookup table file", 0);
+		RETURN_NULL();
+	}
+
+	RETURN_TRUE;
+}
+
+/**
+ * Generate the heads-up preflop equity table file
+ *
+ * Enumerates every suit-isomorphic heads-up matchup over all boards and
+ * writes the results to the given path (~550 KB). Point
+ * phpoker.preflop_table at the file to have heads-up preflop equities
+ * answered from it. Generation takes over an hour on one core.
+ *
+ * @param string $path File to write
+ * @return bool True on success
+ */
+PHP_FUNCTION(poker_generate_preflop_table)
+{
+	char *path;
+	size_t path_len;
+
+	ZEND_PARSE_PARAMETERS_START(1, 1)
+		Z_PARAM_PATH(path, path_len)
+	ZEND_PARSE_PARAMETERS_END();
+
+	if (php_check_open_basedir(path)) {
+		RETURN_FALSE;
+	}
+
+	if (php_poker_preflop_generate(path) == FAILURE) {
+		zend_throw_exception(zend_ce_exception, "Unable to write the preflop table file", 0);
+		RETURN_NULL();
+	}
+
+	RETURN_TRUE;
+}
+
+/**
+ * Preflop equity of a starting hand against random opponents
+ *
+ * Served from the precomputed chart in preflop_chart.h: the pot share of
+ * each of the 169 starting hand classes against 1-9 random hands, all in
+ * before the flop, to two decimals.
+ *
+ * @param string|array|int $hand Starting hand class ("AKs", "T9o", "QQ", "AK"), two cards
+ *                              ("AhKh"), a list of two card ids or a card mask
+ * @param int $opponents Number of random opponents (1-9)
+ * @return float Equity in percent
+ */
+PHP_FUNCTION(poker_preflop_equity)
+{
+	zval *hand_zv;
+	zend_long opponents = 1;
+	int cards[3];
+	int high, low, suitedness;
+
+	ZEND_PARSE_PARAMETERS_START(1, 2)
+		Z_PARAM_ZVAL(hand_zv)
+		Z_PARAM_OPTIONAL
+		Z_PARAM_LONG(opponents)
+	ZEND_PARSE_PARAMETERS_END();
+
+	if (opponents < 1 || opponents > 9) {
+		zend_throw_exception(zend_ce_exception, "Number of opponents must be between 1 and 9", 0);
+		RETURN_NULL();
+	}
+
+	/* Two cards in any encoding, or else a starting hand class */
+	if (php_poker_zval_cards(hand_zv, cards, 2) == 2 && cards[0] != cards[1]) {
+		high = RANK(cards[0]) > RANK(cards[1]) ? RANK(cards[0]) : RANK(cards[1]);
+		low = RANK(cards[0]) > RANK(cards[1]) ? RANK(cards[1]) : RANK(cards[0]);
+		suitedness = php_poker_suit_index(cards[0]) == php_poker_suit_index(cards[1]) ? PHP_POKER_SUITED : PHP_POKER_OFFSUIT;
+	} else if (Z_TYPE_P(hand_zv) != IS_STRING || Z_STRLEN_P(hand_zv) < 2
+		|| php_poker_parse_range_class(Z_STRVAL_P(hand_zv), &high, &low, &suitedness) != (int)Z_STRLEN_P(hand_zv)) {
+		zend_throw_exception(zend_ce_exception, "Invalid starting hand (need a class like AKs or two cards)", 0);
+		RETURN_NULL();
+	}
+
+	RETURN_DOUBLE(php_poker_chart_lookup(high, low, suitedness, (int)opponents));
+}
+
+/**
+ * Generate the preflop equity chart as a C header
+ *
+ * Samples every starting hand class against 1-9 random opponents and writes
+ * the table compiled in as src/preflop_chart.h. Heads-up cells are exact
+ * when phpoker.preflop_table is loaded. Rebuild the extension afterwards.
+ *
+ * @param string $path File to write
+ * @param int $iterations Deals per sampled cell
+ * @return bool True on success
+ */
+PHP_FUNCTION(poker_generate_preflop_chart)
+{
+	char *path;
+	size_t path_len;
+	zend_long iterations = 4000000;
+
+	ZEND_PARSE_PARAMETERS_START(1, 2)
+		Z_PARAM_PATH(path, path_len)
+		Z_PARAM_OPTIONAL
+		Z_PARAM_LONG(iterations)
+	ZEND_PARSE_PARAMETERS_END();
+
+	if (iterations < 1) {
+		zend_throw_exception(zend_ce_exception, "Number of iterations must be positive", 0);
+		RETURN_NULL();
+	}
+
+	if (php_check_open_basedir(path)) {
+		RETURN_FALSE;
+	}
+
+	if (php_poker_chart_generate(path, iterations) == FAILURE) {
+		zend_throw_exception(zend_ce_exception, "Unable to write the preflop chart file", 0);
+		RETURN_NULL();
+	}
+
+	RETURN_TRUE;
+}
+
+/**
+ * Statistics of the equity result caches
+ *
+ * @return array ['enabled', 'capacity', 'entries', 'hits', 'misses', 'evictions'] of the
+ *               per-process cache, with the same keys for the shared-memory cache under 'shared'
+ */
+PHP_FUNCTION(poker_cache_stats)
+{
+	php_poker_cache *cache = &php_poker_cache_state;
+	php_poker_shm *shm = php_poker_shm_cache;
+	zval shared;
+
+	ZEND_PARSE_PARAMETERS_NONE();
+
+	array_init(return_value);
+	pthread_mutex_lock(&cache->lock);
+	add_assoc_bool(return_value, "enabled", cache->entries != NULL);
+	add_assoc_long(return_value, "capacity", cache->entries ? cache->capacity : 0);
+	add_assoc_long(return_value, "entries", cache->count);
+	add_assoc_long(return_value, "hits", cache->hits);
+	add_assoc_long(return_value, "misses", cache->misses);
+	add_assoc_long(return_value, "evictions", cache->evictions);
+	pthread_mutex_unlock(&cache->lock);
+
+	/* The shared-memory cache, counted over all processes */
+	array_init(&shared);
+	add_assoc_bool(&shared, "enabled", php_poker_shm_cache != NULL);
+	add_assoc_long(&shared, "capacity", shm ? (zend_long)(shm->num_sets * PHP_POKER_SHM_WAYS) : 0);
+	add_assoc_long(&shared, "entries", shm ? __atomic_load_n(&shm->entries, __ATOMIC_RELAXED) : 0);
+	add_assoc_long(&shared, "hits", shm ? __atomic_load_n(&shm->hits, __ATOMIC_RELAXED) : 0);
+	add_assoc_long(&shared, "misses", shm ? __atomic_load_n(&shm->misses, __ATOMIC_RELAXED) : 0);
+	add_assoc_long(&shared, "evictions", shm ? __atomic_load_n(&shm->evictions, __ATOMIC_RELAXED) : 0);
+	add_assoc_zval(return_value, "shared", &shared);
+}
+
+/**
+ * Empty the per-process equity result cache and reset its statistics
+ *
+ * @return bool True, or false when the cache is disabled
+ */
+PHP_FUNCTION(poker_cache_clear)
+{
+	ZEND_PARSE_PARAMETERS_NONE();
+
+	if (!php_poker_cache_state.entries) {
+		RETURN_FALSE;
+	}
+
+	php_poker_cache_clear();
+
+	RETURN_TRUE;
+}
+
+/**
+ * Fill the combo index tables (card indices and card mask of every combo)
+ */
+static void php_poker_init_combo_tables(void)
+{
+	int index1, index2, combo;
+
+	for (index2 = 1; index2 < 52; index2++) {
+		for (index1 = 0; index1 < index2; index1++) {
+			combo = php_poker_combo_index(index1, index2);
+			php_poker_combo_cards[combo][0] = (unsigned char)index2;
+			php_poker_combo_cards[combo][1] = (unsigned char)index1;
+			php_poker_combo_masks[combo] = (1ULL << index1) | (1ULL << index2);
+		}
+	}
+}
+
+/**
+ * Get the Range object behind a zend_object
+ *
+ * @param obj Object
+ * @return php_poker_range_object* Range object
+ */
+static inline php_poker_range_object *php_poker_range_from_obj(zend_object *obj)
+{
+	return (php_poker_range_object *)((char *)obj - XtOffsetOf(php_poker_range_object, std));
+}
+
+/**
+ * Check whether a range holds a combo
+ *
+ * @param range Range object
+ * @param combo Combo index
+ * @return int 1 if the combo is in the range, 0 otherwise
+ */
+static inline int php_poker_range_has(const php_poker_range_object *range, int combo)
+{
+	return (int)((range->bits[combo >> 6] >> (combo & 63)) & 1);
+}
+
+/**
+ * Weight of a combo in a range
+ *
+ * @param range Range object
+ * @param combo Combo index
+ * @return double Weight, or 0 if the combo is not in the range
+ */
+static inline double php_poker_range_weight(const php_poker_range_object *range, int combo)
+{
+	if (!php_poker_range_has(range, combo)) {
+		return 0.0;
+	}
+
+	return range->weights ? range->weights[combo] : 1.0;
+}
+
+/**
+ * Add a combo to a range, or remove it when the weight is 0
+ *
+ * The weight vector is only allocated once a weight other than 1 is set.
+ *
+ * @param range Range object
+ * @param combo Combo index
+ * @param weight Weight (0 to 1)
+ */
+static void php_poker_range_set(php_poker_range_object *range, int combo, double weight)
+{
+	int i;
+
+	if (weight <= 0.0) {
+		range->bits[combo >> 6] &= ~(1ULL << (combo & 63));
+		return;
+	}
+
+	range->bits[combo >> 6] |= 1ULL << (combo & 63);
+
+	if (weight != 1.0 && !range->weights) {
+		range->weights = emalloc(sizeof(double) * PHP_POKER_COMBOS);
+
+		for (i = 0; i < PHP_POKER_COMBOS; i++) {
+			range->weights[i] = 1.0;
+		}
+	}
+
+	if (range->weights) {
+		range->weights[combo] = weight;
+	}
+}
+
+/**
+ * Replace the contents of a range with a weight per combo index
+ *
+ * @param range Range object
+ * @param weights Weight per combo index (0 leaves the combo out)
+ */
+static void php_poker_range_load(php_poker_range_object *range, const double *weights)
+{
+	int combo;
+
+	memset(range->bits, 0, sizeof(range->bits));
+
+	for (combo = 0; combo < PHP_POKER_COMBOS; combo++) {
+		if (weights[combo] > 0.0) {
+			php_poker_range_set(range, combo, weights[combo]);
+		}
+	}
+}
+
+/**
+ * Expand a range into a weight per combo index
+ *
+ * @param range Range object
+ * @param weights Receives the weight per combo index (0 for combos not in the range)
+ */
+static void php_poker_range_weights(const php_poker_range_object *range, double *weights)
+{
+	int combo;
+
+	for (combo = 0; combo < PHP_POKER_COMBOS; combo++) {
+		weights[combo] = php_poker_range_weight(range, combo);
+	}
+}
+
+/**
+ * Next combo of a range, starting at a given combo index
+ *
+ * @param range Range object
+ * @param combo First combo index to consider
+ * @return int Combo index, or PHP_POKER_COMBOS if there is none
+ */
+static int php_poker_range_next(const php_poker_range_object *range, int combo)
+{
+	uint64_t word;
+
+	while (combo < PHP_POKER_COMBOS) {
+		word = range->bits[combo >> 6] >> (combo & 63);
+
+		if (word) {
+			while (!(word & 1)) {
+				word >>= 1;
+				combo++;
+			}
+
+			return combo;
+		}
+
+		combo = (combo | 63) + 1;
+	}
+
+	return PHP_POKER_COMBOS;
+}
+
+/**
+ * Parse a single combo such as "AhKd"
+ *
+ * @param combo_str Combo text
+ * @return int Combo index, or -1 if invalid
+ */
+static int php_poker_parse_combo(const char *combo_str)
+{
+	int cards[3];
+
+	if (php_poker_parse_hand(combo_str, cards, 3) != 2 || cards[0] == cards[1]) {
+		return -1;
+	}
+
+	return php_poker_combo_index(php_poker_card_index(cards[0]), php_poker_card_index(cards[1]));
+}
+
+/**
+ * Write the name of a combo index (e.g. "AhKd")
+ *
+ * @param name Buffer of at least 5 characters
+ * @param combo Combo index
+ */
+static void php_poker_combo_index_name(char *name, int combo)
+{
+	php_poker_combo_name(name,
+		php_poker_make_card(php_poker_combo_cards[combo][0] % 13, php_poker_combo_cards[combo][0] / 13),
+		php_poker_make_card(php_poker_combo_cards[combo][1] % 13, php_poker_combo_cards[combo][1] / 13));
+}
+
+/**
+ * Create a new, empty Range object in a zval
+ *
+ * @param zv Receives the object
+ * @return php_poker_range_object* The new range
+ */
+static php_poker_range_object *php_poker_range_init(zval *zv)
+{
+	object_init_ex(zv, php_poker_range_ce);
+
+	return php_poker_range_from_obj(Z_OBJ_P(zv));
+}
+
+/**
+ * Allocate a Range object (create_object handler)
+ *
+ * @param ce Class entry
+ * @return zend_object* New object
+ */
+static zend_object *php_poker_range_create(zend_class_entry *ce)
+{
+	php_poker_range_object *range = zend_object_alloc(sizeof(php_poker_range_object), ce);
+
+	memset(range->bits, 0, sizeof(range->bits));
+	range->weights = NULL;
+
+	zend_object_std_init(&range->std, ce);
+	object_properties_init(&range->std, ce);
+	range->std.handlers = &php_poker_range_handlers;
+
+	return &range->std;
+}
+
+/**
+ * Release a Range object (free_obj handler)
+ *
+ * @param obj Object
+ */
+static void php_poker_range_free(zend_object *obj)
+{
+	php_poker_range_object *range = php_poker_range_from_obj(obj);
+
+	if (range->weights) {
+		efree(range->weights);
+	}
+
+	zend_object_std_dtor(obj);
+}
+
+/**
+ * Copy a Range object (clone_obj handler)
+ *
+ * @param old_obj Object to copy
+ * @return zend_object* New object
+ */
+static zend_object *php_poker_range_clone(zend_object *old_obj)
+{
+	php_poker_range_object *old_range = php_poker_range_from_obj(old_obj);
+	zend_object *new_obj = php_poker_range_create(old_obj->ce);
+	php_poker_range_object *new_range = php_poker_range_from_obj(new_obj);
+
+	zend_objects_clone_members(new_obj, old_obj);
+	memcpy(new_range->bits, old_range->bits, sizeof(old_range->bits));
+
+	if (old_range->weights) {
+		new_range->weights = emalloc(sizeof(double) * PHP_POKER_COMBOS);
+		memcpy(new_range->weights, old_range->weights, sizeof(double) * PHP_POKER_COMBOS);
+	}
+
+	return new_obj;
+}
+
+/**
+ * Range iterator handlers: the iterator walks the set bits in combo index order
+ */
+static void php_poker_range_it_dtor(zend_object_iterator *iter)
+{
+	php_poker_range_iterator *it = (php_poker_range_iterator *)iter;
+
+	zval_ptr_dtor(&it->intern.data);
+	zval_ptr_dtor(&it->current);
+}
+
+static int php_poker_range_it_valid(zend_object_iterator *iter)
+{
+	return ((php_poker_range_iterator *)iter)->combo < PHP_POKER_COMBOS ? SUCCESS : FAILURE;
+}
+
+static zval *php_poker_range_it_get_current_data(zend_object_iterator *iter)
+{
+	php_poker_range_iterator *it = (php_poker_range_iterator *)iter;
+
+	ZVAL_DOUBLE(&it->current, php_poker_range_weight(php_poker_range_from_obj(Z_OBJ(it->intern.data)), it->combo));
+
+	return &it->current;
+}
+
+static void php_poker_range_it_get_current_key(zend_object_iterator *iter, zval *key)
+{
+	php_poker_range_iterator *it = (php_poker_range_iterator *)iter;
+	char name[5];
+
+	php_poker_combo_index_name(name, it->combo);
+	ZVAL_STRINGL(key, name, 4);
+}
+
+static void php_poker_range_it_move_forward(zend_object_iterator *iter)
+{
+	php_poker_range_iterator *it = (php_poker_range_iterator *)iter;
+
+	it->combo = php_poker_range_next(php_poker_range_from_obj(Z_OBJ(it->intern.data)), it->combo + 1);
+}
+
+static void php_poker_range_it_rewind(zend_object_iterator *iter)
+{
+	php_poker_range_iterator *it = (php_poker_range_iterator *)iter;
+
+	it->combo = php_poker_range_next(php_poker_range_from_obj(Z_OBJ(it->intern.data)), 0);
+}
+
+static const zend_object_iterator_funcs php_poker_range_it_funcs = {
+	.dtor = php_poker_range_it_dtor,
+	.valid = php_poker_range_it_valid,
+	.get_current_data = php_poker_range_it_get_current_data,
+	.get_current_key = php_poker_range_it_get_current_key,
+	.move_forward = php_poker_range_it_move_forward,
+	.rewind = php_poker_range_it_rewind,
+};
+
+/**
+ * Create an iterator over a Range (get_iterator handler)
+ *
+ * @param ce Class entry
+ * @param object Range being iterated
+ * @param by_ref Whether iteration is by reference (not supported)
+ * @return zend_object_iterator* Iterator, or NULL on error
+ */
+static zend_object_iterator *php_poker_range_get_iterator(zend_class_entry *ce, zval *object, int by_ref)
+{
+	php_poker_range_iterator *it;
+
+	if (by_ref) {
+		zend_throw_exception(zend_ce_exception, "A range cannot be iterated by reference", 0);
+		return NULL;
+	}
+
+	it = emalloc(sizeof(php_poker_range_iterator));
+	zend_iterator_init(&it->intern);
+
+	ZVAL_OBJ_COPY(&it->intern.data, Z_OBJ_P(object));
+	it->intern.funcs = &php_poker_range_it_funcs;
+	it->combo = PHP_POKER_COMBOS;
+	ZVAL_UNDEF(&it->current);
+
+	return &it->intern;
+}
+
+/**
+ * Create a range from range notation
+ *
+ * @param string $range Optional range such as "QQ+, AKs, T9s-76s, AhKh:0.5"
+ */
+PHP_METHOD(PHPoker_Range, __construct)
+{
+	char *range_str = "";
+	size_t range_len = 0;
+	double weights[PHP_POKER_COMBOS];
+
+	ZEND_PARSE_PARAMETERS_START(0, 1)
+		Z_PARAM_OPTIONAL
+		Z_PARAM_STRING(range_str, range_len)
+	ZEND_PARSE_PARAMETERS_END();
+
+	if (range_len > 0 && php_poker_parse_range(range_str, weights) == FAILURE) {
+		zend_throw_exception(zend_ce_exception, "Invalid hand range", 0);
+		RETURN_NULL();
+	}
+
+	if (range_len > 0) {
+		php_poker_range_load(php_poker_range_from_obj(Z_OBJ_P(ZEND_THIS)), weights);
+	}
+}
+
+/**
+ * Combos in this range or the other one
+ *
+ * Combos in both keep this range's weight.
+ *
+ * @param Range $other Range to merge
+ * @return Range New range
+ */
+PHP_METHOD(PHPoker_Range, union)
+{
+	zval *other_zv;
+	php_poker_range_object *range, *other, *result;
+	int combo;
+
+	ZEND_PARSE_PARAMETERS_START(1, 1)
+		Z_PARAM_OBJECT_OF_CLASS(other_zv, php_poker_range_ce)
+	ZEND_PARSE_PARAMETERS_END();
+
+	range = php_poker_range_from_obj(Z_OBJ_P(ZEND_THIS));
+	other = php_poker_range_from_obj(Z_OBJ_P(other_zv));
+	result = php_poker_range_init(return_value);
+
+	for (combo = 0; combo < PHP_POKER_COMBOS; combo++) {
+		if (php_poker_range_has(range, combo)) {
+			php_poker_range_set(result, combo, php_poker_range_weight(range, combo));
+		} else if (php_poker_range_has(other, combo)) {
+			php_poker_range_set(result, combo, php_poker_range_weight(other, combo));
+		}
+	}
+}
+
+/**
+ * Combos in both this range and the other one, with this range's weights
+ *
+ * @param Range $other Range to intersect with
+ * @return Range New range
+ */
+PHP_METHOD(PHPoker_Range, intersect)
+{
+	zval *other_zv;
+	php_poker_range_object *range, *other, *result;
+	int combo;
+
+	ZEND_PARSE_PARAMETERS_START(1, 1)
+		Z_PARAM_OBJECT_OF_CLASS(other_zv, php_poker_range_ce)
+	ZEND_PARSE_PARAMETERS_END();
+
+	range = php_poker_range_from_obj(Z_OBJ_P(ZEND_THIS));
+	other = php_poker_range_from_obj(Z_OBJ_P(other_zv));
+	result = php_poker_range_init(return_value);
+
+	for (combo = 0; combo < PHP_POKER_COMBOS; combo++) {
+		if (php_poker_range_has(range, combo) && php_poker_range_has(other, combo)) {
+			php_poker_range_set(result, combo, php_poker_range_weight(range, combo));
+		}
+	}
+}
+
+/**
+ * Combos in this range that are not in the other one
+ *
+ * @param Range $other Range to remove
+ * @return Range New range
+ */
+PHP_METHOD(PHPoker_Range, subtract)
+{
+	zval *other_zv;
+	php_poker_range_object *range, *other, *result;
+	int combo;
+
+	ZEND_PARSE_PARAMETERS_START(1, 1)
+		Z_PARAM_OBJECT_OF_CLASS(other_zv, php_poker_range_ce)
+	ZEND_PARSE_PARAMETERS_END();
+
+	range = php_poker_range_from_obj(Z_OBJ_P(ZEND_THIS));
+	other = php_poker_range_from_obj(Z_OBJ_P(other_zv));
+	result = php_poker_range_init(return_value);
+
+	for (combo = 0; combo < PHP_POKER_COMBOS; combo++) {
+		if (php_poker_range_has(range, combo) && !php_poker_range_has(other, combo)) {
+			php_poker_range_set(result, combo, php_poker_range_weight(range, combo));
+		}
+	}
+}
+
+/**
+ * Remove every combo that uses one of the given cards (e.g. board blockers)
+ *
+ * @param int|string|array $cards 64-bit card mask (bit suit * 13 + rank, suits in clubs,
+ *                                diamonds, hearts, spades order), cards such as "Ah Kd 2c",
+ *                                or a list of card strings or ids
+ * @return Range New range
+ */
+PHP_METHOD(PHPoker_Range, removeCards)
+{
+	zval *cards_zv;
+	php_poker_range_object *range, *result;
+	uint64_t mask;
+	int cards[53];
+	int num_cards, combo;
+
+	ZEND_PARSE_PARAMETERS_START(1, 1)
+		Z_PARAM_ZVAL(cards_zv)
+	ZEND_PARSE_PARAMETERS_END();
+
+	if ((num_cards = php_poker_zval_cards(cards_zv, cards, 52)) < 0) {
+		zend_throw_exception(zend_ce_exception, "Invalid card format", 0);
+		RETURN_NULL();
+	}
+
+	mask = php_poker_cards_mask(cards, num_cards);
+
+	range = php_poker_range_from_obj(Z_OBJ_P(ZEND_THIS));
+	result = php_poker_range_init(return_value);
+
+	for (combo = php_poker_range_next(range, 0); combo < PHP_POKER_COMBOS; combo = php_poker_range_next(range, combo + 1)) {
+		if (!(php_poker_combo_masks[combo] & mask)) {
+			php_poker_range_set(result, combo, php_poker_range_weight(range, combo));
+		}
+	}
+}
+
+/**
+ * Set the weight of combos in this range
+ *
+ * @param float $weight Weight between 0 and 1 (0 removes the combos)
+ * @param string|Range|null $combos Combos to weight (default: all of them)
+ * @return Range New range
+ */
+PHP_METHOD(PHPoker_Range, withWeight)
+{
+	double weight;
+	zval *combos_zv = NULL;
+	php_poker_range_object *range, *result, *subset;
+	double weights[PHP_POKER_COMBOS];
+	int combo;
+
+	ZEND_PARSE_PARAMETERS_START(1, 2)
+		Z_PARAM_DOUBLE(weight)
+		Z_PARAM_OPTIONAL
+		Z_PARAM_ZVAL_OR_NULL(combos_zv)
+	ZEND_PARSE_PARAMETERS_END();
+
+	if (!(weight >= 0.0) || weight > 1.0) {
+		zend_throw_exception(zend_ce_exception, "Weight must be between 0 and 1", 0);
+		RETURN_NULL();
+	}
+
+	if (combos_zv == NULL) {
+		for (combo = 0; combo < PHP_POKER_COMBOS; combo++) {
+			weights[combo] = 1.0;
+		}
+	} else if (Z_TYPE_P(combos_zv) == IS_STRING) {
+		if (php_poker_parse_range(Z_STRVAL_P(combos_zv), weights) == FAILURE) {
+			zend_throw_exception(zend_ce_exception, "Invalid hand range", 0);
+			RETURN_NULL();
+		}
+	} else if (Z_TYPE_P(combos_zv) == IS_OBJECT && instanceof_function(Z_OBJCE_P(combos_zv), php_poker_range_ce)) {
+		subset = php_poker_range_from_obj(Z_OBJ_P(combos_zv));
+		php_poker_range_weights(subset, weights);
+	} else {
+		zend_throw_exception(zend_ce_exception, "Combos must be a range string or a PHPoker\\Range", 0);
+		RETURN_NULL();
+	}
+
+	range = php_poker_range_from_obj(Z_OBJ_P(ZEND_THIS));
+	result = php_poker_range_init(return_value);
+
+	for (combo = php_poker_range_next(range, 0); combo < PHP_POKER_COMBOS; combo = php_poker_range_next(range, combo + 1)) {
+		php_poker_range_set(result, combo, weights[combo] > 0.0 ? weight : php_poker_range_weight(range, combo));
+	}
+}
+
+/**
+ * Weight of one combo
+ *
+ * @param string $combo Combo such as "AhKd"
+ * @return float Weight, or 0 if the combo is not in the range
+ */
+PHP_METHOD(PHPoker_Range, weight)
+{
+	char *combo_str;
+	size_t combo_len;
+	int combo;
+
+	ZEND_PARSE_PARAMETERS_START(1, 1)
+		Z_PARAM_STRING(combo_str, combo_len)
+	ZEND_PARSE_PARAMETERS_END();
+
+	if ((combo = php_poker_parse_combo(combo_str)) < 0) {
+		zend_throw_exception(zend_ce_exception, "Invalid combo (need exactly 2 different cards)", 0);
+		RETURN_NULL();
+	}
+
+	RETURN_DOUBLE(php_poker_range_weight(php_poker_range_from_obj(Z_OBJ_P(ZEND_THIS)), combo));
+}
+
+/**
+ * Check whether the range holds a combo
+ *
+ * @param string $combo Combo such as "AhKd"
+ * @return bool True if the combo is in the range
+ */
+PHP_METHOD(PHPoker_Range, contains)
+{
+	char *combo_str;
+	size_t combo_len;
+	int combo;
+
+	ZEND_PARSE_PARAMETERS_START(1, 1)
+		Z_PARAM_STRING(combo_str, combo_len)
+	ZEND_PARSE_PARAMETERS_END();
+
+	if ((combo = php_poker_parse_combo(combo_str)) < 0) {
+		zend_throw_exception(zend_ce_exception, "Invalid combo (need exactly 2 different cards)", 0);
+		RETURN_NULL();
+	}
+
+	RETURN_BOOL(php_poker_range_has(php_poker_range_from_obj(Z_OBJ_P(ZEND_THIS)), combo));
+}
+
+/**
+ * Number of combos in the range
+ *
+ * @return int Combo count
+ */
+PHP_METHOD(PHPoker_Range, count)
+{
+	php_poker_range_object *range;
+	zend_long count = 0;
+	uint64_t word;
+	int i;
+
+	ZEND_PARSE_PARAMETERS_NONE();
+
+	range = php_poker_range_from_obj(Z_OBJ_P(ZEND_THIS));
+
+	for (i = 0; i < (int)(sizeof(range->bits) / sizeof(range->bits[0])); i++) {
+		for (word = range->bits[i]; word; word &= word - 1) {
+			count++;
+		}
+	}
+
+	RETURN_LONG(count);
+}
+
+/**
+ * Sum of the weights of all combos in the range
+ *
+ * @return float Weighted combo count
+ */
+PHP_METHOD(PHPoker_Range, weightedCount)
+{
+	php_poker_range_object *range;
+	double total = 0.0;
+	int combo;
+
+	ZEND_PARSE_PARAMETERS_NONE();
+
+	range = php_poker_range_from_obj(Z_OBJ_P(ZEND_THIS));
+
+	for (combo = php_poker_range_next(range, 0); combo < PHP_POKER_COMBOS; combo = php_poker_range_next(range, combo + 1)) {
+		total += php_poker_range_weight(range, combo);
+	}
+
+	RETURN_DOUBLE(total);
+}
+
+/**
+ * Combos of the range with their weights
+ *
+ * @return array Weight per combo name (e.g. ["AsAc" => 1.0, ...])
+ */
+PHP_METHOD(PHPoker_Range, toArray)
+{
+	php_poker_range_object *range;
+	char name[5];
+	int combo;
+
+	ZEND_PARSE_PARAMETERS_NONE();
+
+	range = php_poker_range_from_obj(Z_OBJ_P(ZEND_THIS));
+	array_init(return_value);
+
+	for (combo = php_poker_range_next(range, 0); combo < PHP_POKER_COMBOS; combo = php_poker_range_next(range, combo + 1)) {
+		php_poker_combo_index_name(name, combo);
+		add_assoc_double(return_value, name, php_poker_range_weight(range, combo));
+	}
+}
+
+/**
+ * Iterate over the combos of the range
+ *
+ * @return Iterator Yields combo name => weight
+ */
+PHP_METHOD(PHPoker_Range, getIterator)
+{
+	ZEND_PARSE_PARAMETERS_NONE();
+
+	zend_create_internal_iterator_zval(return_value, ZEND_THIS);
+}
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_range_construct, 0, 0, 0)
+	ZEND_ARG_TYPE_INFO(0, range, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_range_set_operation, 0, 1, PHPoker\\Range, 0)
+	ZEND_ARG_OBJ_INFO(0, other, PHPoker\\Range, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_range_remove_cards, 0, 1, PHPoker\\Range, 0)
+	ZEND_ARG_INFO(0, cards)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_range_with_weight, 0, 1, PHPoker\\Range, 0)
+	ZEND_ARG_TYPE_INFO(0, weight, IS_DOUBLE, 0)
+	ZEND_ARG_INFO(0, combos)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_range_weight, 0, 1, IS_DOUBLE, 0)
+	ZEND_ARG_TYPE_INFO(0, combo, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_range_contains, 0, 1, _IS_BOOL, 0)
+	ZEND_ARG_TYPE_INFO(0, combo, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_range_count, 0, 0, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_range_weighted_count, 0, 0, IS_DOUBLE, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_range_to_array, 0, 0, IS_ARRAY, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_range_get_iterator, 0, 0, Iterator, 0)
+ZEND_END_ARG_INFO()
+
+static const zend_function_entry php_poker_range_methods[] = {
+	PHP_ME(PHPoker_Range, __construct, arginfo_range_construct, ZEND_ACC_PUBLIC)
+	PHP_ME(PHPoker_Range, union, arginfo_range_set_operation, ZEND_ACC_PUBLIC)
+	PHP_ME(PHPoker_Range, intersect, arginfo_range_set_operation, ZEND_ACC_PUBLIC)
+	PHP_ME(PHPoker_Range, subtract, arginfo_range_set_operation, ZEND_ACC_PUBLIC)
+	PHP_ME(PHPoker_Range, removeCards, arginfo_range_remove_cards, ZEND_ACC_PUBLIC)
+	PHP_ME(PHPoker_Range, withWeight, arginfo_range_with_weight, ZEND_ACC_PUBLIC)
+	PHP_ME(PHPoker_Range, weight, arginfo_range_weight, ZEND_ACC_PUBLIC)
+	PHP_ME(PHPoker_Range, contains, arginfo_range_contains, ZEND_ACC_PUBLIC)
+	PHP_ME(PHPoker_Range, count, arginfo_range_count, ZEND_ACC_PUBLIC)
+	PHP_ME(PHPoker_Range, weightedCount, arginfo_range_weighted_count, ZEND_ACC_PUBLIC)
+	PHP_ME(PHPoker_Range, toArray, arginfo_range_to_array, ZEND_ACC_PUBLIC)
+	PHP_ME(PHPoker_Range, getIterator, arginfo_range_get_iterator, ZEND_ACC_PUBLIC)
+	PHP_FE_END
+};
+
+/**
+ * Register the PHPoker\Range class (called from MINIT)
+ */
+static void php_poker_register_range_class(void)
+{
+	zend_class_entry ce;
+
+	INIT_NS_CLASS_ENTRY(ce, "PHPoker", "Range", php_poker_range_methods);
+	php_poker_range_ce = zend_register_internal_class(&ce);
+	php_poker_range_ce->create_object = php_poker_range_create;
+	php_poker_range_ce->get_iterator = php_poker_range_get_iterator;
+	zend_class_implements(php_poker_range_ce, 2, zend_ce_aggregate, zend_ce_countable);
+
+	memcpy(&php_poker_range_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+	php_poker_range_handlers.offset = XtOffsetOf(php_poker_range_object, std);
+	php_poker_range_handlers.free_obj = php_poker_range_free;
+	php_poker_range_handlers.clone_obj = php_poker_range_clone;
+}
+
+/**
+ * Get the EquityCalculator from its zend_object
+ *
+ * @param obj Object
+ * @return php_poker_calculator_object* EquityCalculator
+ */
+static inline php_poker_calculator_object *php_poker_calculator_from_obj(zend_object *obj)
+{
+	return (php_poker_calculator_object *)((char *)obj - XtOffsetOf(php_poker_calculator_object, std));
+}
+
+/**
+ * Enumerate a flop or turn spot by the next card, unless the rows of the
+ * current cards are already there
+ *
+ * Only plain high-hand spots that would be enumerated anyway are broken
+ * down: the rows then sum up to the exact result, and each one is the
+ * exact result once its card is dealt.
+ *
+ * @param calc EquityCalculator
+ * @param iterations Iterations asked for, 0 or less for the default
+ * @return int SUCCESS when calc holds the rows, FAILURE when the spot needs the general path
+ */
+static int php_poker_calculator_rows(php_poker_calculator_object *calc, zend_long iterations)
+{
+	php_poker_scenario *sc = &calc->sc;
+	zend_long total;
+	int remaining_board_count = 5 - sc->eq.board_count;
+	int num_cards;
+
+	if (calc->num_rows > 0) {
+		return SUCCESS;
+	}
+
+	if ((sc->eq.board_count != 3 && sc->eq.board_count != 4) || sc->mode == PHP_POKER_MODE_MONTE_CARLO
+		|| sc->eq.num_ranges > 0 || sc->eq.num_unknown > 0 || sc->eq.hilo || sc->eq.categories) {
+		return FAILURE;
+	}
+
+	num_cards = php_poker_prepare_deck(calc->row_cards, sc->used);
+
+	if (num_cards < remaining_board_count) {
+		return FAILURE; /* Reported by the general path */
+	}
+
+	total = php_poker_choose(num_cards, remaining_board_count);
+
+	if (sc->mode == PHP_POKER_MODE_AUTO && total > PHPOKER_G(exact_threshold) && total > php_poker_scenario_iterations(sc, iterations)) {
+		return FAILURE;
+	}
+
+	php_poker_runouts(&sc->eq, calc->row_cards, num_cards, NULL, calc->row_wins, calc->row_ties, NULL);
+	calc->num_rows = num_cards;
+
+	return SUCCESS;
+}
+
+/**
+ * Forget the results kept for the previous cards
+ *
+ * @param calc EquityCalculator
+ */
+static void php_poker_calculator_reset(php_poker_calculator_object *calc)
+{
+	calc->num_rows = 0;
+	calc->ready = 0;
+}
+
+/**
+ * Read a card for EquityCalculator::addBoardCard() or addDeadCard()
+ *
+ * @param calc EquityCalculator
+ * @param zv Card string or card id
+ * @param card Receives the card value
+ * @param format_error Message for an unreadable card
+ * @param duplicate_error Message for a card already in play
+ * @return int SUCCESS, or FAILURE with an exception thrown
+ */
+static int php_poker_calculator_card(php_poker_calculator_object *calc, zval *zv, int *card, const char *format_error, const char *duplicate_error)
+{
+	if (calc->sc.eq.num_players < 2) {
+		zend_throw_exception(zend_ce_exception, "EquityCalculator is not initialized", 0);
+		return FAILURE;
+	}
+
+	if (php_poker_zval_card(zv, card) == FAILURE) {
+		zend_throw_exception(zend_ce_exception, format_error, 0);
+		return FAILURE;
+	}
+
+	/* The short deck gaps are in the used mask, so check them first */
+	if (calc->sc.eq.game == PHP_POKER_GAME_SHORTDECK && (php_poker_card_bit(*card) & ~PHP_POKER_SHORT_DECK_MASK)) {
+		zend_throw_exception(zend_ce_exception, "Short deck has no cards below six", 0);
+		return FAILURE;
+	}
+
+	if (calc->sc.used & php_poker_card_bit(*card)) {
+		zend_throw_exception(zend_ce_exception, duplicate_error, 0);
+		return FAILURE;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * Allocate an EquityCalculator object (create_object handler)
+ *
+ * @param ce Class entry
+ * @return zend_object* New object
+ */
+static zend_object *php_poker_calculator_create(zend_class_entry *ce)
+{
+	php_poker_calculator_object *calc = zend_object_alloc(sizeof(php_poker_calculator_object), ce);
+
+	memset(&calc->sc, 0, sizeof(calc->sc));
+	calc->num_rows = 0;
+	calc->ready = 0;
+
+	zend_object_std_init(&calc->std, ce);
+	object_properties_init(&calc->std, ce);
+	calc->std.handlers = &php_poker_calculator_handlers;
+
+	return &calc->std;
+}
+
+/**
+ * Release an EquityCalculator object (free_obj handler)
+ *
+ * @param obj Object
+ */
+static void php_poker_calculator_free(zend_object *obj)
+{
+	php_poker_scenario_free(&php_poker_calculator_from_obj(obj)->sc);
+
+	zend_object_std_dtor(obj);
+}
+
+/**
+ * Copy an EquityCalculator object (clone_obj handler)
+ *
+ * The copy keeps the results of the original, and goes its own way from
+ * the next card added to either.
+ *
+ * @param old_obj Object to copy
+ * @return zend_object* New object
+ */
+static zend_object *php_poker_calculator_clone(zend_object *old_obj)
+{
+	php_poker_calculator_object *old_calc = php_poker_calculator_from_obj(old_obj);
+	zend_object *new_obj = php_poker_calculator_create(old_obj->ce);
+	php_poker_calculator_object *new_calc = php_poker_calculator_from_obj(new_obj);
+	int i;
+
+	zend_objects_clone_members(new_obj, old_obj);
+	memcpy((char *)new_calc, (char *)old_calc, XtOffsetOf(php_poker_calculator_object, std));
+
+	for (i = 0; i < 10; i++) {
+		if (old_calc->sc.weights[i]) {
+			new_calc->sc.weights[i] = emalloc(sizeof(double) * PHP_POKER_COMBOS);
+			memcpy(new_calc->sc.weights[i], old_calc->sc.weights[i], sizeof(double) * PHP_POKER_COMBOS);
+		}
+	}
+
+	return new_obj;
+}
+
+/**
+ * Parse and check a scenario once, for calculating it after each new card
+ *
+ * @param array $hole_cards Each player's hole cards or hand range (as for poker_calculate_equity)
+ * @param array|int $board_cards Optional board cards
+ * @param array|int $dead_cards Optional cards that are no longer in the deck
+ * @param array $options Optional settings, as for poker_calculate_equity
+ */
+PHP_METHOD(PHPoker_EquityCalculator, __construct)
+{
+	zval *hole_cards_array, *board_cards_array = NULL, *dead_cards_array = NULL, *options_array = NULL;
+	php_poker_calculator_object *calc = php_poker_calculator_from_obj(Z_OBJ_P(ZEND_THIS));
+
+	ZEND_PARSE_PARAMETERS_START(1, 4)
+		Z_PARAM_ARRAY(hole_cards_array)
+		Z_PARAM_OPTIONAL
+		Z_PARAM_ZVAL(board_cards_array)
+		Z_PARAM_ZVAL(dead_cards_array)
+		Z_PARAM_ARRAY_OR_NULL(options_array)
+	ZEND_PARSE_PARAMETERS_END();
+
+	php_poker_scenario_free(&calc->sc);
+	memset(&calc->sc, 0, sizeof(calc->sc));
+	php_poker_calculator_reset(calc);
+
+	if (zend_hash_num_elements(Z_ARRVAL_P(hole_cards_array)) < 2) {
+		zend_throw_exception(zend_ce_exception, "At least 2 players needed for equity calculation", 0);
+		RETURN_NULL();
+	}
+
+	if (php_poker_scenario_options(&calc->sc, options_array ? Z_ARRVAL_P(options_array) : NULL) == FAILURE
+		|| php_poker_scenario_cards(&calc->sc, Z_ARRVAL_P(hole_cards_array), board_cards_array, dead_cards_array) == FAILURE) {
+		php_poker_scenario_free(&calc->sc);
+		memset(&calc->sc, 0, sizeof(calc->sc));
+		RETURN_NULL();
+	}
+}
+
+/**
+ * Deal the next board card
+ *
+ * When the last calculation enumerated the flop or turn, the equity with
+ * this card out is already known and the next calculate() returns it
+ * without dealing a board.
+ *
+ * @param string|int $card Card string ("Ah") or card id
+ * @return EquityCalculator This calculator
+ */
+PHP_METHOD(PHPoker_EquityCalculator, addBoardCard)
+{
+	zval *card_zv;
+	php_poker_calculator_object *calc = php_poker_calculator_from_obj(Z_OBJ_P(ZEND_THIS));
+	php_poker_equity *eq = &calc->sc.eq;
+	int card;
+	int i;
+
+	ZEND_PARSE_PARAMETERS_START(1, 1)
+		Z_PARAM_ZVAL(card_zv)
+	ZEND_PARSE_PARAMETERS_END();
+
+	if (php_poker_calculator_card(calc, card_zv, &card, "Invalid board card format", "Duplicate card found on board") == FAILURE) {
+		RETURN_NULL();
+	}
+
+	if (eq->board_count >= 5) {
+		zend_throw_exception(zend_ce_exception, "Board cannot have more than 5 cards", 0);
+		RETURN_NULL();
+	}
+
+	/* Narrow the enumeration down to the row of this card */
+	calc->ready = 0;
+
+	for (i = 0; i < calc->num_rows; i++) {
+		if (calc->row_cards[i] == card) {
+			memcpy(calc->ready_wins, calc->row_wins[i], sizeof(calc->ready_wins));
+			memcpy(calc->ready_ties, calc->row_ties[i], sizeof(calc->ready_ties));
+			calc->ready_total = eq->board_count == 3 ? calc->num_rows - 1 : 1;
+			calc->ready = 1;
+			break;
+		}
+	}
+
+	calc->num_rows = 0;
+
+	eq->board[eq->board_count++] = card;
+	calc->sc.used |= php_poker_card_bit(card);
+
+	RETURN_COPY(ZEND_THIS);
+}
+
+/**
+ * Take a card out of the deck
+ *
+ * On the turn, the last enumeration stays usable without this card's river.
+ *
+ * @param string|int $card Card string ("Ah") or card id
+ * @return EquityCalculator This calculator
+ */
+PHP_METHOD(PHPoker_EquityCalculator, addDeadCard)
+{
+	zval *card_zv;
+	php_poker_calculator_object *calc = php_poker_calculator_from_obj(Z_OBJ_P(ZEND_THIS));
+	int card;
+	int i;
+
+	ZEND_PARSE_PARAMETERS_START(1, 1)
+		Z_PARAM_ZVAL(card_zv)
+	ZEND_PARSE_PARAMETERS_END();
+
+	if (php_poker_calculator_card(calc, card_zv, &card, "Invalid dead card format", "Dead card already in use by player or on board") == FAILURE) {
+		RETURN_NULL();
+	}
+
+	/* Turn rows are single rivers: drop this one. Flop rows mix every
+	 * river with their turn card, so they are all gone.
+	 */
+	calc->ready = 0;
+
+	if (calc->sc.eq.board_count == 4) {
+		for (i = 0; i < calc->num_rows; i++) {
+			if (calc->row_cards[i] == card) {
+				calc->num_rows--;
+				calc->row_cards[i] = calc->row_cards[calc->num_rows];
+				memcpy(calc->row_wins[i], calc->row_wins[calc->num_rows], sizeof(calc->row_wins[i]));
+				memcpy(calc->row_ties[i], calc->row_ties[calc->num_rows], sizeof(calc->row_ties[i]));
+				break;
+			}
+		}
+	} else {
+		calc->num_rows = 0;
+	}
+
+	calc->sc.dead_cards[calc->sc.dead_count++] = card;
+	calc->sc.used |= php_poker_card_bit(card);
+
+	RETURN_COPY(ZEND_THIS);
+}
+
+/**
+ * Calculate the equity with the cards dealt so far
+ *
+ * @param int $iterations Optional number of iterations, as for poker_calculate_equity
+ * @return array Array with equity information for each player, as from poker_calculate_equity
+ */
+PHP_METHOD(PHPoker_EquityCalculator, calculate)
+{
+	zend_long iterations = 0;
+	zend_long total;
+	php_poker_calculator_object *calc = php_poker_calculator_from_obj(Z_OBJ_P(ZEND_THIS));
+	php_poker_equity eq = calc->sc.eq;
+	int i, j;
+
+	ZEND_PARSE_PARAMETERS_START(0, 1)
+		Z_PARAM_OPTIONAL
+		Z_PARAM_LONG(iterations)
+	ZEND_PARSE_PARAMETERS_END();
+
+	if (eq.num_players < 2) {
+		zend_throw_exception(zend_ce_exception, "EquityCalculator is not initialized", 0);
+		RETURN_NULL();
+	}
+
+	/* Narrowed down from the enumeration of the previous street */
+	if (calc->ready) {
+		memcpy(eq.wins, calc->ready_wins, sizeof(eq.wins));
+		memcpy(eq.ties, calc->ready_ties, sizeof(eq.ties));
+		php_poker_scenario_result(&calc->sc, &eq, calc->ready_total, PHP_POKER_MODE_EXACT, return_value);
+		return;
+	}
+
+	if (php_poker_calculator_rows(calc, iterations) == FAILURE) {
+		php_poker_scenario_calculate(&calc->sc, iterations, return_value);
+		return;
+	}
+
+	/* Each flop board sits in the rows of both its turn and river cards */
+	for (i = 0; i < calc->num_rows; i++) {
+		for (j = 0; j < eq.num_players; j++) {
+			eq.wins[j] += calc->row_wins[i][j];
+			eq.ties[j] += calc->row_ties[i][j];
+		}
+	}
+
+	total = calc->num_rows;
+
+	if (eq.board_count == 3) {
+		for (j = 0; j < eq.num_players; j++) {
+			eq.wins[j] /= 2;
+			eq.ties[j] /= 2;
+		}
+
+		total = php_poker_choose(calc->num_rows, 2);
+	}
+
+	php_poker_scenario_result(&calc->sc, &eq, total, PHP_POKER_MODE_EXACT, return_value);
+}
+
+/**
+ * Board cards dealt so far
+ *
+ * @return array Card strings
+ */
+PHP_METHOD(PHPoker_EquityCalculator, board)
+{
+	php_poker_calculator_object *calc = php_poker_calculator_from_obj(Z_OBJ_P(ZEND_THIS));
+	char name[3];
+	int i;
+
+	ZEND_PARSE_PARAMETERS_NONE();
+
+	array_init_size(return_value, calc->sc.eq.board_count);
+
+	for (i = 0; i < calc->sc.eq.board_count; i++) {
+		php_poker_card_name(name, calc->sc.eq.board[i]);
+		add_next_index_stringl(return_value, name, 2);
+	}
+}
+
+/**
+ * Dead cards so far
+ *
+ * @return array Card strings
+ */
+PHP_METHOD(PHPoker_EquityCalculator, deadCards)
+{
+	php_poker_calculator_object *calc = php_poker_calculator_from_obj(Z_OBJ_P(ZEND_THIS));
+	char name[3];
+	int i;
+
+	ZEND_PARSE_PARAMETERS_NONE();
+
+	array_init_size(return_value, calc->sc.dead_count);
+
+	for (i = 0; i < calc->sc.dead_count; i++) {
+		php_poker_card_name(name, calc->sc.dead_cards[i]);
+		add_next_index_stringl(return_value, name, 2);
+	}
+}
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_calculator_construct, 0, 0, 1)
+	ZEND_ARG_TYPE_INFO(0, hole_cards, IS_ARRAY, 0)
+	ZEND_ARG_INFO(0, board_cards)
+	ZEND_ARG_INFO(0, dead_cards)
+	ZEND_ARG_TYPE_INFO(0, options, IS_ARRAY, 1)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_calculator_add_card, 0, 1, PHPoker\\EquityCalculator, 0)
+	ZEND_ARG_INFO(0, card)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_calculator_calculate, 0, 0, IS_ARRAY, 0)
+	ZEND_ARG_TYPE_INFO(0, iterations, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_calculator_cards, 0, 0, IS_ARRAY, 0)
+ZEND_END_ARG_INFO()
+
+static const zend_function_entry php_poker_calculator_methods[] = {
+	PHP_ME(PHPoker_EquityCalculator, __construct, arginfo_calculator_construct, ZEND_ACC_PUBLIC)
+	PHP_ME(PHPoker_EquityCalculator, addBoardCard, arginfo_calculator_add_card, ZEND_ACC_PUBLIC)
+	PHP_ME(PHPoker_EquityCalculator, addDeadCard, arginfo_calculator_add_card, ZEND_ACC_PUBLIC)
+	PHP_ME(PHPoker_EquityCalculator, calculate, arginfo_calculator_calculate, ZEND_ACC_PUBLIC)
+	PHP_ME(PHPoker_EquityCalculator, board, arginfo_calculator_cards, ZEND_ACC_PUBLIC)
+	PHP_ME(PHPoker_EquityCalculator, deadCards, arginfo_calculator_cards, ZEND_ACC_PUBLIC)
+	PHP_FE_END
+};
+
+/**
+ * Register the PHPoker\EquityCalculator class (called from MINIT)
+ */
+static void php_poker_register_calculator_class(void)
+{
+	zend_class_entry ce;
+
+	INIT_NS_CLASS_ENTRY(ce, "PHPoker", "EquityCalculator", php_poker_calculator_methods);
+	php_poker_calculator_ce = zend_register_internal_class(&ce);
+	php_poker_calculator_ce->ce_flags |= ZEND_ACC_FINAL;
+	php_poker_calculator_ce->create_object = php_poker_calculator_create;
+
+	memcpy(&php_poker_calculator_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+	php_poker_calculator_handlers.offset = XtOffsetOf(php_poker_calculator_object, std);
+	php_poker_calculator_handlers.free_obj = php_poker_calculator_free;
+	php_poker_calculator_handlers.clone_obj = php_poker_calculator_clone;
 }
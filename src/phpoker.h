@@ -10,30 +10,503 @@ extern zend_module_entry phpoker_module_entry;
 ZEND_TSRMLS_CACHE_EXTERN()
 #endif
 
+ZEND_BEGIN_MODULE_GLOBALS(phpoker)
+	char *evaluator;      /* phpoker.evaluator: "cactus" or "twoplustwo" */
+	char *lookup_table;   /* phpoker.lookup_table: Two Plus Two table file */
+	zend_long exact_threshold; /* phpoker.exact_threshold: max boards for automatic exact mode */
+	zend_long threads;    /* phpoker.threads: default Monte Carlo thread count */
+	char *preflop_table;  /* phpoker.preflop_table: heads-up preflop equity file */
+	zend_long cache_size; /* phpoker.cache_size: equity results kept per process, 0 for none */
+	zend_long shared_cache_size; /* phpoker.shared_cache_size: equity results kept in shared memory, 0 for none */
+	zend_long shared_cache_ttl;  /* phpoker.shared_cache_ttl: seconds a shared result stays valid, 0 for no limit */
+ZEND_END_MODULE_GLOBALS(phpoker)
+
+ZEND_EXTERN_MODULE_GLOBALS(phpoker)
+
+#define PHPOKER_G(v) ZEND_MODULE_GLOBALS_ACCESSOR(phpoker, v)
+
 /* Declare user functions */
 PHP_FUNCTION(poker_evaluate_hand);
+PHP_FUNCTION(poker_evaluate_hands);
+PHP_FUNCTION(poker_evaluate_omaha);
+PHP_FUNCTION(poker_evaluate_short_deck);
+PHP_FUNCTION(poker_evaluate_low);
+PHP_FUNCTION(poker_cards_to_ids);
+PHP_FUNCTION(poker_cards_to_mask);
+PHP_FUNCTION(poker_cards_to_string);
 PHP_FUNCTION(poker_calculate_equity);
+PHP_FUNCTION(poker_calculate_runouts);
+PHP_FUNCTION(poker_generate_lookup_table);
+PHP_FUNCTION(poker_generate_preflop_table);
+PHP_FUNCTION(poker_preflop_equity);
+PHP_FUNCTION(poker_generate_preflop_chart);
+PHP_FUNCTION(poker_cache_stats);
+PHP_FUNCTION(poker_cache_clear);
+
+/* PHPoker\Range methods */
+PHP_METHOD(PHPoker_Range, __construct);
+PHP_METHOD(PHPoker_Range, union);
+PHP_METHOD(PHPoker_Range, intersect);
+PHP_METHOD(PHPoker_Range, subtract);
+PHP_METHOD(PHPoker_Range, removeCards);
+PHP_METHOD(PHPoker_Range, withWeight);
+PHP_METHOD(PHPoker_Range, weight);
+PHP_METHOD(PHPoker_Range, contains);
+PHP_METHOD(PHPoker_Range, count);
+PHP_METHOD(PHPoker_Range, weightedCount);
+PHP_METHOD(PHPoker_Range, toArray);
+PHP_METHOD(PHPoker_Range, getIterator);
+
+/* PHPoker\EquityCalculator methods */
+PHP_METHOD(PHPoker_EquityCalculator, __construct);
+PHP_METHOD(PHPoker_EquityCalculator, addBoardCard);
+PHP_METHOD(PHPoker_EquityCalculator, addDeadCard);
+PHP_METHOD(PHPoker_EquityCalculator, calculate);
+PHP_METHOD(PHPoker_EquityCalculator, board);
+PHP_METHOD(PHPoker_EquityCalculator, deadCards);
 
 /* Module functions */
 PHP_MINIT_FUNCTION(phpoker);
 PHP_MSHUTDOWN_FUNCTION(phpoker);
 PHP_MINFO_FUNCTION(phpoker);
+PHP_GINIT_FUNCTION(phpoker);
+
+/* Two Plus Two state ids pack up to seven cards, one per byte */
+typedef uint64_t php_poker_tpt_id;
+
+/* Header of a Two Plus Two state table file */
+typedef struct {
+	char magic[8];
+	uint32_t version;
+	uint32_t entries;
+} php_poker_tpt_header;
+
+/* Header of a heads-up preflop equity table file */
+typedef struct {
+	char magic[8];
+	uint32_t version;
+	uint32_t entries;
+} php_poker_preflop_header;
+
+/* One canonical heads-up matchup, sorted by key. Wins and ties are counted
+ * for the first combo of the key over all C(48,5) boards.
+ */
+typedef struct {
+	uint32_t key;            /* combo1 * PHP_POKER_COMBOS + combo2 */
+	uint32_t wins;
+	uint32_t ties;
+} php_poker_preflop_entry;
+
+/* Board cards summarized for the direct evaluator */
+typedef struct {
+	unsigned key;            /* Sum of rank_keys */
+	unsigned suits;          /* Packed suit counter (see php_poker_flush_suit) */
+	int ranks[16];           /* Rank bits per suit, indexed by suit bit >> 12 */
+	int num_cards;
+	const unsigned short *flush_lookup; /* Lookup tables of the game being played */
+	const unsigned short *rank_lookup;
+} php_poker_board_state;
+
+/* Batch evaluation kernel: hands of 5-7 cards in 7-slot rows */
+typedef void (*php_poker_eval_batch_func)(const int *cards, const unsigned char *num_cards, size_t count, unsigned short *values);
+
+/* Number of distinct two-card combos */
+#define PHP_POKER_COMBOS 1326
+
+/* A player's hand range after card removal, with a Walker alias table for
+ * weighted sampling. Built by the calling thread, read-only afterwards.
+ */
+typedef struct {
+	int count;                          /* Combos left */
+	int first;                          /* Offset of this range's per-combo counters */
+	int cards[PHP_POKER_COMBOS][2];
+	uint64_t masks[PHP_POKER_COMBOS];   /* Card bits of each combo */
+	short combos[PHP_POKER_COMBOS];     /* Combo index (see php_poker_combo_index) */
+	double prob[PHP_POKER_COMBOS];      /* Chance to keep the drawn slot */
+	int alias[PHP_POKER_COMBOS];        /* Slot taken otherwise */
+} php_poker_range;
+
+/* PHPoker\Range object: a bit per combo index, plus weights once any differ from 1 */
+typedef struct {
+	uint64_t bits[(PHP_POKER_COMBOS + 63) / 64];
+	double *weights;         /* Weight per combo index, or NULL */
+	zend_object std;
+} php_poker_range_object;
+
+/* Iterator over a PHPoker\Range, yielding combo name => weight */
+typedef struct {
+	zend_object_iterator intern;
+	int combo;               /* Current combo index, PHP_POKER_COMBOS when done */
+	zval current;
+} php_poker_range_iterator;
+
+/* Board of an Omaha showdown, pre-combined into every 3-card subset */
+typedef struct {
+	int count;               /* Number of subsets: 1, 4 or 10 for 3, 4 or 5 board cards */
+	int ranks[10];           /* Rank bits of each subset */
+	int flush[10];           /* Suit bit when all three cards share a suit, 0 otherwise */
+	int primes[10];          /* Product of the rank primes */
+	int low[10];             /* Low bits of subsets that can make a low, 0 otherwise */
+} php_poker_omaha_board;
+
+/* Per-call equity state shared by the Monte Carlo and exact paths */
+typedef struct {
+	int game;                /* PHP_POKER_GAME_* */
+	int num_players;
+	int player_hands[10][5]; /* Hole cards, php_poker_game_hole_cards[game] per player */
+	int board[5];
+	int board_count;
+	int tpt_states[10];      /* Two Plus Two state after each player's known cards */
+	zend_long wins[10];
+	zend_long ties[10];
+	int hilo;                /* Split the pot between the best high and the best eight-or-better low */
+	zend_long shares[10];    /* Hi-lo pot won, in PHP_POKER_POT_UNITS per board */
+	zend_long share_squares[10]; /* Sum of the squared hi-lo shares, for the standard error */
+	zend_long scoops[10];    /* Hi-lo boards won outright */
+	zend_long high_only[10]; /* Hi-lo boards with a share of the high half only */
+	zend_long low_only[10];  /* Hi-lo boards with a share of the low half only */
+	zend_long partial_scoops[10]; /* Hi-lo boards with a share of both halves, short of the whole pot */
+	int num_ranges;          /* Players holding a hand range instead of two cards */
+	const php_poker_range *ranges[10]; /* Hand range per player, NULL for fixed hole cards */
+	int combos[10];          /* Slot of the combo dealt from each range this iteration */
+	zend_long (*combo_stats)[3]; /* Wins, ties and deals per range combo, or NULL */
+	int categories;          /* Count hand categories (see php_poker_count_categories) */
+	zend_long hand_counts[10][9]; /* Final hands by php_poker_hand_rank category - 1 */
+	zend_long win_counts[10][9];  /* Best high hands, alone or tied, by category - 1 */
+	int unknown[10];         /* Hole cards dealt with the board each iteration, in the last slots */
+	int num_unknown;         /* Unknown hole cards of all players */
+} php_poker_equity;
+
+/* A parsed equity calculation: players, cards and settings, checked once
+ * and calculated any number of times (see php_poker_scenario_calculate)
+ */
+typedef struct {
+	php_poker_equity eq;     /* Players and board, counters left at zero */
+	double *weights[10];     /* Combo weights of each hand range player, NULL for fixed hole cards */
+	int dead_cards[53];
+	int dead_count;
+	uint64_t used;           /* Mask of all cards in play, with the short deck gaps */
+	int mode;                /* PHP_POKER_MODE_* asked for */
+	int combo_results;       /* Add each range combo's equity to the results */
+	int use_cache;
+	int has_seed;
+	uint64_t seed;
+	zend_long threads;
+	double precision;        /* Target standard error, 0 for a fixed iteration count */
+	double max_time;         /* Time budget in seconds, 0 for none */
+} php_poker_scenario;
+
+/* PHPoker\EquityCalculator object: a scenario, plus the flop or turn
+ * enumeration broken down by the next card for reuse on the next street
+ */
+typedef struct {
+	php_poker_scenario sc;
+	int num_rows;            /* Rows of the last enumeration, 0 for none */
+	int row_cards[52];       /* Next card of each row */
+	zend_long row_wins[52][10];
+	zend_long row_ties[52][10];
+	int ready;               /* The counters below answer the current cards */
+	zend_long ready_total;
+	zend_long ready_wins[10];
+	zend_long ready_ties[10];
+	zend_object std;
+} php_poker_calculator_object;
+
+/* Suits that are interchangeable for the current deal, grouped into classes */
+typedef struct {
+	int count;
+	int size[4];
+	int suits[4][4];
+} php_poker_suit_classes;
+
+/* Exact board enumeration state */
+typedef struct {
+	php_poker_equity *equity;
+	int available[13][4];    /* Cards left in the deck, by rank and suit index */
+	int evaluated;           /* Distinct boards scored */
+} php_poker_exact;
+
+/* Most threads a single equity calculation can use */
+#define PHP_POKER_MAX_THREADS 64
+
+/* Random stream of one Monte Carlo chunk (xoshiro256** state) */
+typedef struct {
+	uint64_t s[4];
+} php_poker_rng;
+
+/* Monte Carlo run shared between the calling thread and the worker pool */
+typedef struct {
+	pthread_mutex_t lock;     /* Guards next_chunk */
+	const php_poker_equity *equity;
+	const int *deck;
+	int num_cards;
+	zend_long iterations;
+	uint64_t seed;
+	zend_long num_chunks;     /* End of the current round of chunks */
+	zend_long next_chunk;
+	int failed;               /* Set when the hand ranges could not be dealt */
+	uint64_t deadline;        /* php_poker_clock time after which no chunk is started, 0 for none */
+	int expired;              /* Set once the deadline has passed */
+	int num_combos;           /* Size of each participant's combo_stats */
+	int num_threads;          /* Participants, including the caller */
+	php_poker_equity results[PHP_POKER_MAX_THREADS]; /* Counters per participant */
+} php_poker_job;
+
+/* Start-up arguments of a pool worker */
+typedef struct {
+	int index;                /* Slot in php_poker_job.results (the caller is 0) */
+	unsigned generation;      /* Last job generation the worker has seen */
+} php_poker_worker;
+
+/* Persistent Monte Carlo worker pool */
+typedef struct {
+	pthread_mutex_t lock;
+	pthread_cond_t work;      /* A job was posted or the pool is shutting down */
+	pthread_cond_t done;      /* The last worker finished the current job */
+	pthread_t threads[PHP_POKER_MAX_THREADS];
+	php_poker_worker workers[PHP_POKER_MAX_THREADS];
+	int num_threads;          /* Workers running, not counting the caller */
+	int active;               /* Workers still busy with the current job */
+	int shutdown;
+	unsigned generation;      /* Bumped for every job posted */
+	pid_t pid;                /* Process the workers belong to */
+	php_poker_job *job;
+} php_poker_pool;
+
+/* Equity scenario up to suit renaming and player order (see
+ * php_poker_cache_key_init). Compared and hashed bytewise, padding included.
+ */
+typedef struct {
+	uint64_t board;          /* Card masks under the canonical suit renaming */
+	uint64_t dead;
+	uint64_t hands[10];      /* In increasing order */
+	zend_long iterations;    /* Monte Carlo settings, 0 for exact results */
+	double precision;
+	int num_players;
+	int game;
+	int hilo;
+	int mode;                /* PHP_POKER_MODE_EXACT or PHP_POKER_MODE_MONTE_CARLO */
+} php_poker_cache_key;
+
+/* Counters of a cached equity result, by slot of the key */
+typedef struct {
+	zend_long total;
+	zend_long wins[10];
+	zend_long ties[10];
+	zend_long shares[10];
+	zend_long share_squares[10];
+	zend_long scoops[10];
+	zend_long high_only[10];
+	zend_long low_only[10];
+	zend_long partial_scoops[10];
+} php_poker_cache_result;
+
+/* One cached result */
+typedef struct {
+	php_poker_cache_key key;
+	php_poker_cache_result result;
+	zend_ulong hash;
+	int next;                /* Next entry of the same bucket, -1 at the end */
+	int newer;               /* Neighbours in the recently used list, -1 at the ends */
+	int older;
+} php_poker_cache_entry;
+
+/* Per-process LRU equity cache: chained hash buckets over a fixed entry array */
+typedef struct {
+	pthread_mutex_t lock;
+	php_poker_cache_entry *entries; /* NULL when the cache is disabled */
+	int *buckets;            /* First entry of each bucket, -1 when empty */
+	int num_buckets;         /* Power of two, at least the capacity */
+	int capacity;
+	int count;               /* Entries in use, filled from the start */
+	int newest;              /* Ends of the recently used list, -1 when empty */
+	int oldest;
+	zend_long hits;
+	zend_long misses;
+	zend_long evictions;
+} php_poker_cache;
+
+/* Shared-memory cache geometry: slots per set, and locks over all sets */
+#define PHP_POKER_SHM_WAYS 8
+#define PHP_POKER_SHM_SHARDS 64
+
+/* One slot of the shared-memory cache */
+typedef struct {
+	zend_ulong hash;         /* Hash of the key, 0 when the slot is empty */
+	int64_t stored;          /* time() of the store, for the TTL */
+	int64_t used;            /* time() of the last hit, for eviction */
+	php_poker_cache_key key;
+	php_poker_cache_result result;
+} php_poker_shm_slot;
+
+/* Shared-memory equity cache: set-associative slots, the set of a key
+ * picked by its hash, with set % PHP_POKER_SHM_SHARDS naming its lock.
+ * The counters are updated atomically, outside the locks.
+ */
+typedef struct {
+	pthread_mutex_t locks[PHP_POKER_SHM_SHARDS]; /* Process-shared */
+	zend_ulong num_sets;
+	zend_long ttl;           /* Seconds, 0 for no limit */
+	zend_long entries;       /* Slots in use, expired or not */
+	zend_long hits;
+	zend_long misses;
+	zend_long evictions;     /* Live results replaced by newer ones */
+	php_poker_shm_slot slots[];
+} php_poker_shm;
 
 /* Internal function declarations */
 static int php_poker_char_to_rank(char c);
 static int php_poker_char_to_suit(char c);
 static int php_poker_parse_hand(const char *hand_str, int *cards, int max_cards);
-static int php_poker_card_exists(int card, int *deck, int num_cards);
+static int php_poker_parse_cards(const char *hand_str, int *cards, int max_cards, int *unknown);
+static inline int php_poker_card_from_id(int id);
+static void php_poker_card_name(char *name, int card);
+static int php_poker_zval_card(zval *zv, int *card);
+static int php_poker_zval_cards(zval *zv, int *cards, int max_cards);
+static int php_poker_zval_hole_cards(zval *zv, int *cards, int max_cards, int *unknown);
+static uint64_t php_poker_cards_mask(const int *cards, int num_cards);
+static inline int php_poker_popcount(uint64_t mask);
 static unsigned php_poker_find_fast(unsigned u);
 static unsigned short php_poker_eval_5cards(int c1, int c2, int c3, int c4, int c5);
 static unsigned short php_poker_eval_5hand(int *hand);
+static unsigned short php_poker_eval_best_subset(int *hand, int num_cards);
+static inline int php_poker_flush_suit(unsigned suits);
+static inline unsigned php_poker_rank_slot(unsigned key, int num_cards);
+static inline unsigned short php_poker_rank_value(unsigned key, int num_cards);
+static unsigned short php_poker_eval_nhand(int *hand, int num_cards);
+static void php_poker_init_board_state(php_poker_board_state *board, const int *cards, int num_cards, int game);
+static inline unsigned short php_poker_eval_board_hand(const php_poker_board_state *board, int c1, int c2);
+static void php_poker_init_omaha_board(php_poker_omaha_board *board, const int *cards, int num_cards);
+static unsigned short php_poker_eval_omaha_hand(const php_poker_omaha_board *board, const int *hole, int num_hole);
+static unsigned short php_poker_short_value(unsigned short value, int ranks, int flush);
+static unsigned short php_poker_eval_short_cards(int *cards, int num_cards);
+static unsigned short php_poker_eval_6hand(int *hand);
 static unsigned short php_poker_eval_7hand(int *hand);
+static void php_poker_init_flush_lookup(void);
+static void php_poker_fill_rank_lookup(int *counts, int rank, int left, int num_cards);
+static void php_poker_init_eval_tables(void);
+static void php_poker_init_low_lookup(void);
+static inline int php_poker_low_bits(int ranks);
+static int php_poker_eval_low(const int *cards, int num_cards);
+static unsigned short php_poker_eval_deuce_seven(int *cards);
+static int php_poker_eval_omaha_low(const php_poker_omaha_board *board, const int *hole, int num_hole);
+static void php_poker_low_name(char *name, int value);
+static inline int php_poker_suit_index(int card);
+static inline int php_poker_make_card(int rank, int suit);
+static inline int php_poker_tpt_card(int card);
+static inline int php_poker_tpt_walk(int state, int *cards, int num_cards);
+static unsigned short php_poker_tpt_eval(int *hand, int num_cards);
+static php_poker_tpt_id php_poker_tpt_make_id(php_poker_tpt_id id, int card, int *num_cards);
+static unsigned short php_poker_tpt_eval_id(php_poker_tpt_id id);
+static int php_poker_tpt_generate(const char *path);
+static int php_poker_tpt_map(const char *path);
+static void php_poker_tpt_unmap(void);
+static int php_poker_tpt_load(const char *path);
+static uint32_t php_poker_preflop_key(const int *hand1, const int *hand2, int *swapped);
+static int php_poker_preflop_generate(const char *path);
+static int php_poker_preflop_map(const char *path);
+static void php_poker_preflop_unmap(void);
+static int php_poker_preflop_lookup(php_poker_equity *eq);
+static inline int php_poker_chart_class(int high, int low, int suited);
+static double php_poker_chart_equity(int *hand, int opponents, zend_long iterations, uint64_t seed);
+static int php_poker_chart_generate(const char *path, zend_long iterations);
+static double php_poker_chart_lookup(int high, int low, int suitedness, int opponents);
 static int php_poker_hand_rank(unsigned short val);
+static int php_poker_short_hand_rank(unsigned short val);
 static const char* php_poker_get_hand_name(int rank);
-static void php_poker_init_deck(int *deck);
-static void php_poker_init_random_seed();
-static int php_poker_rand_int(int limit);
-static void php_poker_shuffle_deck(int *deck, int num_cards);
-static int php_poker_prepare_deck(int *deck, int *used_cards, int num_used_cards);
+static inline unsigned short php_poker_eval_cards(int *cards, int num_cards);
+static void php_poker_eval_batch_scalar(const int *cards, const unsigned char *num_cards, size_t count, unsigned short *values);
+#ifdef PHP_POKER_SIMD
+__attribute__((target("avx2"))) static void php_poker_eval_batch_avx2(const int *cards, const unsigned char *num_cards, size_t count, unsigned short *values);
+__attribute__((target("avx512f"))) static void php_poker_eval_batch_avx512(const int *cards, const unsigned char *num_cards, size_t count, unsigned short *values);
+#endif
+static void php_poker_init_eval_batch(void);
+static uint64_t php_poker_random_seed(void);
+static inline uint64_t php_poker_clock(void);
+static void php_poker_rng_seed(php_poker_rng *rng, uint64_t seed, uint64_t chunk);
+static inline uint64_t php_poker_rng_next(php_poker_rng *rng);
+static inline int php_poker_rand_int(php_poker_rng *rng, int limit);
+static inline void php_poker_deal_cards(php_poker_rng *rng, int *deck, int num_cards, int num_deal);
+static inline void php_poker_deal_cards_excluding(php_poker_rng *rng, int *deck, int num_cards, int num_deal, uint64_t excluded);
+static int php_poker_prepare_deck(int *deck, uint64_t used);
+static zend_long php_poker_choose(int n, int k);
+static void php_poker_showdown(php_poker_equity *eq, zend_long weight);
+static void php_poker_count_categories(php_poker_equity *eq, const unsigned short *scores, zend_long weight);
+static void php_poker_split_pot(php_poker_equity *eq, const unsigned short *scores, const int *lows, zend_long weight);
+static void php_poker_init_suit_classes(php_poker_suit_classes *classes, php_poker_equity *eq, int *dead_cards, int dead_count);
+static void php_poker_exact_rank(php_poker_exact *ex, int rank, int cls, int remaining, zend_long weight, const php_poker_suit_classes *in, const php_poker_suit_classes *out);
+static int php_poker_enumerate_boards(php_poker_equity *eq, int *deck, int num_cards, int *dead_cards, int dead_count);
+static int php_poker_parse_game(zval *zv);
+static void php_poker_score_hands(const php_poker_equity *eq, const int *board, int board_count, unsigned short *scores);
+static unsigned short php_poker_best_score(const unsigned short *scores, int num_players, int *winners);
+static void php_poker_runouts(const php_poker_equity *eq, const int *deck, int num_cards, zend_long (*shares)[10], zend_long (*wins)[10], zend_long (*ties)[10], uint64_t *outs);
+static inline int php_poker_card_index(int card);
+static inline uint64_t php_poker_card_bit(int card);
+static inline int php_poker_combo_index(int index1, int index2);
+static void php_poker_combo_name(char *name, int card1, int card2);
+static void php_poker_range_add_class(double *weights, int high, int low, int suitedness, double weight);
+static int php_poker_parse_range_class(const char *str, int *high, int *low, int *suitedness);
+static int php_poker_parse_range_token(const char *token, double *weights);
+static int php_poker_parse_range(const char *range_str, double *weights);
+static int php_poker_build_range(php_poker_range *range, const double *weights, uint64_t excluded);
+static int php_poker_sample_ranges(php_poker_equity *eq, php_poker_rng *rng, uint64_t *used);
+static void php_poker_init_combo_tables(void);
+static inline php_poker_range_object *php_poker_range_from_obj(zend_object *obj);
+static inline int php_poker_range_has(const php_poker_range_object *range, int combo);
+static inline double php_poker_range_weight(const php_poker_range_object *range, int combo);
+static void php_poker_range_set(php_poker_range_object *range, int combo, double weight);
+static void php_poker_range_load(php_poker_range_object *range, const double *weights);
+static void php_poker_range_weights(const php_poker_range_object *range, double *weights);
+static int php_poker_range_next(const php_poker_range_object *range, int combo);
+static int php_poker_parse_combo(const char *combo_str);
+static void php_poker_combo_index_name(char *name, int combo);
+static php_poker_range_object *php_poker_range_init(zval *zv);
+static zend_object *php_poker_range_create(zend_class_entry *ce);
+static void php_poker_range_free(zend_object *obj);
+static zend_object *php_poker_range_clone(zend_object *old_obj);
+static zend_object_iterator *php_poker_range_get_iterator(zend_class_entry *ce, zval *object, int by_ref);
+static void php_poker_register_range_class(void);
+static int php_poker_scenario_options(php_poker_scenario *sc, HashTable *options);
+static int php_poker_scenario_cards(php_poker_scenario *sc, HashTable *hole_cards, zval *board_cards, zval *dead_cards);
+static void php_poker_scenario_free(php_poker_scenario *sc);
+static void php_poker_scenario_result(const php_poker_scenario *sc, const php_poker_equity *eq, zend_long total, int mode, zval *return_value);
+static zend_long php_poker_scenario_iterations(const php_poker_scenario *sc, zend_long iterations);
+static int php_poker_scenario_calculate(php_poker_scenario *sc, zend_long iterations, zval *return_value);
+static inline php_poker_calculator_object *php_poker_calculator_from_obj(zend_object *obj);
+static int php_poker_calculator_rows(php_poker_calculator_object *calc, zend_long iterations);
+static void php_poker_calculator_reset(php_poker_calculator_object *calc);
+static int php_poker_calculator_card(php_poker_calculator_object *calc, zval *zv, int *card, const char *format_error, const char *duplicate_error);
+static zend_object *php_poker_calculator_create(zend_class_entry *ce);
+static void php_poker_calculator_free(zend_object *obj);
+static zend_object *php_poker_calculator_clone(zend_object *old_obj);
+static void php_poker_register_calculator_class(void);
+static void php_poker_run_chunks(php_poker_job *job, php_poker_equity *result);
+static void *php_poker_pool_worker(void *arg);
+static int php_poker_pool_grow(int num_workers);
+static void php_poker_pool_shutdown(void);
+static double php_poker_std_error(const php_poker_equity *eq, int player, zend_long iterations);
+static zend_long php_poker_next_round(const php_poker_equity *eq, zend_long done_chunks, zend_long num_chunks, zend_long iterations, double precision);
+static void php_poker_run_job(php_poker_job *job, php_poker_equity *eq, int num_threads, int num_combos);
+static int php_poker_simulate(php_poker_equity *eq, int *deck, int num_cards, zend_long *iterations, uint64_t seed, int num_threads, int num_combos, double precision, uint64_t deadline);
+static inline uint64_t php_poker_permute_mask(uint64_t mask, const unsigned char *perm);
+static void php_poker_cache_key_init(php_poker_cache_key *key, const php_poker_equity *eq, uint64_t dead, int *order);
+static void php_poker_cache_save(php_poker_cache_result *result, const php_poker_equity *eq, const int *order, zend_long total);
+static void php_poker_cache_restore(php_poker_equity *eq, const php_poker_cache_result *result, const int *order);
+static void php_poker_cache_init(zend_long capacity);
+static void php_poker_cache_clear(void);
+static void php_poker_cache_free(void);
+static void php_poker_cache_unlink(php_poker_cache *cache, int index);
+static void php_poker_cache_link(php_poker_cache *cache, int index);
+static int php_poker_cache_find(php_poker_cache *cache, const php_poker_cache_key *key, zend_ulong hash);
+static int php_poker_cache_get(const php_poker_cache_key *key, php_poker_cache_result *result);
+static void php_poker_cache_put(const php_poker_cache_key *key, const php_poker_cache_result *result);
+static int php_poker_shm_init(zend_long capacity, zend_long ttl);
+static void php_poker_shm_free(void);
+static void php_poker_shm_drop(php_poker_shm *shm, php_poker_shm_slot *slots, int count);
+static pthread_mutex_t *php_poker_shm_lock(php_poker_shm *shm, zend_ulong set);
+static int php_poker_shm_get(const php_poker_cache_key *key, php_poker_cache_result *result);
+static void php_poker_shm_put(const php_poker_cache_key *key, const php_poker_cache_result *result);
+static int php_poker_cache_lookup(const php_poker_cache_key *key, php_poker_cache_result *result);
+static void php_poker_cache_store(const php_poker_cache_key *key, const php_poker_cache_result *result);
 
 #endif /* PHPOKER_H */
\ No newline at end of file
@@ -0,0 +1,178 @@
+/*
+** Preflop equity chart: pot share of each starting hand class against
+** 1-9 random opponents, in hundredths of a percent, indexed by
+** php_poker_chart_class(). Generated by poker_generate_preflop_chart()
+** with 4000000 deals per sampled cell (heads-up cells are exact). Do not edit.
+*/
+static const unsigned short php_poker_preflop_chart[169][9] =
+{
+    { 5033,  3069,  2193,  1772,  1551,  1414,  1323,  1252,  1193}, /* 22 */
+    { 3230,  1977,  1397,  1082,   896,   769,   683,   612,   556}, /* 32o */
+    { 3320,  2066,  1474,  1150,   955,   825,   732,   660,   604}, /* 42o */
+    { 3428,  2148,  1543,  1207,  1000,   862,   762,   689,   629}, /* 52o */
+    { 3408,  2081,  1466,  1124,   913,   772,   674,   601,   540}, /* 62o */
+    { 3458,  2047,  1427,  1078,   858,   719,   616,   540,   477}, /* 72o */
+    { 3683,  2180,  1516,  1146,   911,   756,   646,   561,   496}, /* 82o */
+    { 3910,  2306,  1609,  1217,   973,   805,   685,   593,   522}, /* 92o */
+    { 4167,  2477,  1733,  1324,  1063,   882,   756,   657,   578}, /* T2o */
+    { 4435,  2649,  1855,  1417,  1140,   951,   811,   702,   621}, /* J2o */
+    { 4730,  2863,  2014,  1546,  1246,  1040,   891,   773,   679}, /* Q2o */
+    { 5051,  3118,  2210,  1703,  1386,  1162,   994,   867,   766}, /* K2o */
+    { 5493,  3523,  2547,  1985,  1625,  1377,  1186,  1041,   921}, /* A2o */
+    { 3598,  2382,  1815,  1503,  1306,  1170,  1070,   988,   915}, /* 32s */
+    { 5369,  3364,  2398,  1901,  1625,  1461,  1345,  1262,  1202}, /* 33 */
+    { 3515,  2257,  1641,  1292,  1075,   936,   829,   749,   687}, /* 43o */
+    { 3626,  2348,  1722,  1361,  1144,   991,   881,   802,   735}, /* 53o */
+    { 3608,  2278,  1646,  1283,  1055,   903,   795,   714,   647}, /* 63o */
+    { 3660,  2251,  1603,  1224,   993,   836,   722,   637,   573}, /* 73o */
+    { 3748,  2236,  1568,  1191,   950,   786,   672,   583,   514}, /* 83o */
+    { 4002,  2390,  1676,  1270,  1012,   837,   706,   612,   538}, /* 93o */
+    { 4259,  2556,  1802,  1376,  1105,   916,   779,   672,   594}, /* T3o */
+    { 4528,  2733,  1925,  1475,  1186,   983,   836,   724,   637}, /* J3o */
+    { 4822,  2950,  2083,  1596,  1293,  1076,   916,   793,   697}, /* Q3o */
+    { 5143,  3203,  2285,  1759,  1429,  1196,  1021,   887,   782}, /* K3o */
+    { 5584,  3622,  2634,  2059,  1692,  1432,  1236,  1081,   961}, /* A3o */
+    { 3683,  2469,  1889,  1564,  1363,  1225,  1116,  1028,   959}, /* 42s */
+    { 3864,  2642,  2040,  1693,  1472,  1319,  1209,  1115,  1039}, /* 43s */
+    { 5702,  3678,  2628,  2058,  1728,  1522,  1388,  1291,  1214}, /* 44 */
+    { 3816,  2533,  1884,  1505,  1262,  1099,   982,   893,   819}, /* 54o */
+    { 3801,  2470,  1828,  1442,  1196,  1032,   912,   827,   754}, /* 64o */
+    { 3855,  2445,  1780,  1388,  1137,   968,   846,   754,   682}, /* 74o */
+    { 3945,  2440,  1745,  1345,  1083,   907,   778,   686,   609}, /* 84o */
+    { 4067,  2450,  1731,  1315,  1048,   865,   735,   635,   558}, /* 94o */
+    { 4350,  2647,  1875,  1432,  1147,   951,   803,   697,   611}, /* T4o */
+    { 4619,  2820,  1998,  1527,  1226,  1017,   865,   747,   655}, /* J4o */
+    { 4913,  3036,  2157,  1656,  1334,  1110,   945,   815,   714}, /* Q4o */
+    { 5233,  3294,  2360,  1822,  1474,  1234,  1051,   912,   801}, /* K4o */
+    { 5673,  3715,  2713,  2125,  1746,  1473,  1271,  1115,   987}, /* A4o */
+    { 3785,  2549,  1951,  1617,  1404,  1256,  1148,  1058,   984}, /* 52s */
+    { 3969,  2730,  2118,  1759,  1532,  1378,  1258,  1162,  1084}, /* 53s */
+    { 4145,  2901,  2273,  1888,  1649,  1475,  1352,  1252,  1164}, /* 54s */
+    { 6032,  4006,  2892,  2247,  1852,  1606,  1441,  1322,  1240}, /* 55 */
+    { 3994,  2663,  1991,  1584,  1325,  1147,  1017,   918,   843}, /* 65o */
+    { 4051,  2647,  1964,  1552,  1284,  1102,   969,   869,   789}, /* 75o */
+    { 4143,  2642,  1935,  1508,  1231,  1042,   905,   799,   723}, /* 85o */
+    { 4267,  2655,  1915,  1473,  1190,   991,   850,   740,   657}, /* 95o */
+    { 4425,  2706,  1931,  1480,  1188,   986,   838,   724,   637}, /* T5o */
+    { 4718,  2911,  2073,  1593,  1277,  1058,   895,   771,   675}, /* J5o */
+    { 5012,  3127,  2234,  1721,  1387,  1152,   978,   844,   736}, /* Q5o */
+    { 5331,  3392,  2437,  1886,  1526,  1276,  1088,   942,   826}, /* K5o */
+    { 5770,  3816,  2802,  2200,  1803,  1524,  1311,  1145,  1014}, /* A5o */
+    { 3767,  2478,  1880,  1542,  1324,  1178,  1065,   978,   902}, /* 62s */
+    { 3953,  2666,  2047,  1683,  1457,  1296,  1176,  1082,  1008}, /* 63s */
+    { 4133,  2849,  2215,  1832,  1588,  1415,  1289,  1187,  1106}, /* 64s */
+    { 4313,  3030,  2368,  1974,  1704,  1516,  1383,  1277,  1189}, /* 65s */
+    { 6328,  4320,  3149,  2449,  2008,  1728,  1536,  1402,  1301}, /* 66 */
+    { 4232,  2843,  2141,  1708,  1421,  1219,  1073,   961,   878}, /* 76o */
+    { 4324,  2842,  2119,  1679,  1382,  1180,  1028,   919,   831}, /* 86o */
+    { 4449,  2856,  2106,  1648,  1344,  1132,   977,   862,   770}, /* 96o */
+    { 4609,  2914,  2119,  1649,  1335,  1119,   954,   832,   736}, /* T6o */
+    { 4784,  2976,  2137,  1647,  1321,  1098,   930,   804,   706}, /* J6o */
+    { 5102,  3225,  2317,  1791,  1440,  1197,  1015,   874,   762}, /* Q6o */
+    { 5422,  3488,  2523,  1961,  1588,  1327,  1129,   975,   855}, /* K6o */
+    { 5768,  3792,  2752,  2144,  1743,  1460,  1249,  1087,   956}, /* A6o */
+    { 3816,  2459,  1843,  1497,  1277,  1126,  1015,   924,   853}, /* 72s */
+    { 4004,  2643,  2009,  1639,  1402,  1234,  1116,  1018,   940}, /* 73s */
+    { 4185,  2827,  2177,  1788,  1533,  1358,  1226,  1127,  1045}, /* 74s */
+    { 4368,  3013,  2347,  1938,  1669,  1479,  1342,  1234,  1145}, /* 75s */
+    { 4537,  3190,  2510,  2077,  1784,  1584,  1436,  1322,  1225}, /* 76s */
+    { 6624,  4646,  3440,  2680,  2186,  1859,  1638,  1481,  1362}, /* 77 */
+    { 4505,  3039,  2305,  1839,  1527,  1304,  1141,  1018,   921}, /* 87o */
+    { 4630,  3065,  2303,  1829,  1507,  1279,  1111,   985,   884}, /* 97o */
+    { 4791,  3124,  2321,  1837,  1507,  1271,  1097,   961,   861}, /* T7o */
+    { 4968,  3190,  2335,  1830,  1488,  1243,  1062,   917,   812}, /* J7o */
+    { 5177,  3308,  2391,  1857,  1504,  1251,  1062,   918,   799}, /* Q7o */
+    { 5519,  3595,  2621,  2046,  1658,  1386,  1179,  1021,   890}, /* K7o */
+    { 5884,  3927,  2876,  2249,  1829,  1534,  1308,  1135,   996}, /* A7o */
+    { 4027,  2585,  1936,  1568,  1332,  1169,  1044,   951,   875}, /* 82s */
+    { 4087,  2633,  1980,  1607,  1361,  1194,  1070,   972,   893}, /* 83s */
+    { 4270,  2815,  2144,  1748,  1487,  1307,  1171,  1065,   983}, /* 84s */
+    { 4454,  3010,  2317,  1905,  1627,  1435,  1282,  1176,  1085}, /* 85s */
+    { 4624,  3195,  2495,  2060,  1766,  1559,  1404,  1288,  1190}, /* 86s */
+    { 4794,  3380,  2663,  2210,  1895,  1673,  1504,  1376,  1273}, /* 87s */
+    { 6916,  4990,  3755,  2947,  2401,  2029,  1767,  1586,  1447}, /* 88 */
+    { 4810,  3270,  2503,  2005,  1663,  1419,  1235,  1093,   984}, /* 98o */
+    { 4972,  3343,  2536,  2039,  1690,  1438,  1249,  1102,   989}, /* T8o */
+    { 5149,  3415,  2560,  2033,  1671,  1410,  1214,  1063,   944}, /* J8o */
+    { 5360,  3525,  2610,  2059,  1684,  1412,  1206,  1048,   924}, /* Q8o */
+    { 5602,  3690,  2716,  2131,  1737,  1455,  1243,  1077,   944}, /* K8o */
+    { 5987,  4046,  2990,  2348,  1918,  1611,  1381,  1197,  1047}, /* A8o */
+    { 4242,  2710,  2030,  1642,  1393,  1220,  1092,   991,   911}, /* 92s */
+    { 4326,  2781,  2085,  1689,  1428,  1247,  1110,  1006,   926}, /* 93s */
+    { 4386,  2834,  2134,  1728,  1459,  1276,  1136,  1032,   945}, /* 94s */
+    { 4572,  3024,  2308,  1875,  1587,  1392,  1242,  1128,  1038}, /* 95s */
+    { 4743,  3217,  2482,  2040,  1734,  1520,  1359,  1239,  1141}, /* 96s */
+    { 4912,  3410,  2666,  2203,  1885,  1655,  1481,  1352,  1253}, /* 97s */
+    { 5080,  3593,  2849,  2363,  2024,  1782,  1596,  1453,  1340}, /* 98s */
+    { 7206,  5358,  4112,  3255,  2662,  2242,  1941,  1719,  1557}, /* 99 */
+    { 5153,  3563,  2764,  2250,  1888,  1619,  1413,  1259,  1132}, /* T9o */
+    { 5325,  3636,  2785,  2249,  1876,  1598,  1383,  1220,  1090}, /* J9o */
+    { 5536,  3755,  2842,  2276,  1888,  1599,  1379,  1205,  1066}, /* Q9o */
+    { 5781,  3923,  2949,  2349,  1946,  1645,  1413,  1231,  1085}, /* K9o */
+    { 6077,  4161,  3108,  2459,  2024,  1705,  1462,  1272,  1117}, /* A9o */
+    { 4484,  2865,  2150,  1743,  1486,  1301,  1165,  1061,   975}, /* T2s */
+    { 4569,  2941,  2211,  1792,  1520,  1331,  1188,  1077,   988}, /* T3s */
+    { 4653,  3020,  2273,  1844,  1563,  1363,  1215,  1098,  1001}, /* T4s */
+    { 4722,  3080,  2324,  1882,  1597,  1391,  1239,  1120,  1024}, /* T5s */
+    { 4894,  3271,  2499,  2042,  1734,  1513,  1350,  1220,  1120}, /* T6s */
+    { 5064,  3468,  2690,  2219,  1890,  1657,  1476,  1342,  1232}, /* T7s */
+    { 5233,  3668,  2889,  2396,  2054,  1810,  1622,  1475,  1355}, /* T8s */
+    { 5403,  3871,  3097,  2593,  2238,  1977,  1773,  1615,  1482}, /* T9s */
+    { 7501,  5757,  4518,  3633,  2994,  2520,  2170,  1914,  1715}, /* TT */
+    { 5525,  3906,  3073,  2534,  2150,  1857,  1633,  1451,  1305}, /* JTo */
+    { 5729,  4018,  3131,  2569,  2171,  1867,  1626,  1441,  1289}, /* QTo */
+    { 5974,  4197,  3237,  2645,  2220,  1913,  1666,  1469,  1309}, /* KTo */
+    { 6272,  4430,  3395,  2752,  2298,  1970,  1711,  1506,  1337}, /* ATo */
+    { 4738,  3033,  2272,  1846,  1567,  1374,  1231,  1121,  1029}, /* J2s */
+    { 4823,  3113,  2334,  1891,  1608,  1403,  1256,  1137,  1041}, /* J3s */
+    { 4907,  3196,  2401,  1939,  1646,  1433,  1278,  1154,  1059}, /* J4s */
+    { 4999,  3274,  2465,  1998,  1689,  1470,  1306,  1178,  1074}, /* J5s */
+    { 5061,  3337,  2521,  2045,  1732,  1507,  1335,  1208,  1101}, /* J6s */
+    { 5232,  3535,  2708,  2216,  1884,  1641,  1456,  1316,  1203}, /* J7s */
+    { 5402,  3740,  2913,  2400,  2050,  1793,  1602,  1448,  1326}, /* J8s */
+    { 5566,  3944,  3121,  2600,  2234,  1962,  1752,  1588,  1456}, /* J9s */
+    { 5753,  4194,  3384,  2861,  2484,  2195,  1980,  1801,  1656}, /* JTs */
+    { 7747,  6115,  4918,  4027,  3360,  2849,  2466,  2169,  1931}, /* JJ */
+    { 5813,  4140,  3253,  2693,  2289,  1978,  1733,  1530,  1368}, /* QJo */
+    { 6057,  4307,  3371,  2774,  2346,  2025,  1776,  1566,  1394}, /* KJo */
+    { 6356,  4550,  3530,  2884,  2433,  2094,  1821,  1605,  1427}, /* AJo */
+    { 5017,  3245,  2427,  1970,  1678,  1474,  1316,  1196,  1102}, /* Q2s */
+    { 5102,  3318,  2489,  2018,  1715,  1503,  1344,  1214,  1115}, /* Q3s */
+    { 5186,  3400,  2554,  2074,  1758,  1531,  1368,  1238,  1134}, /* Q4s */
+    { 5277,  3484,  2625,  2128,  1804,  1567,  1395,  1258,  1152}, /* Q5s */
+    { 5361,  3573,  2699,  2193,  1852,  1609,  1427,  1287,  1172}, /* Q6s */
+    { 5430,  3648,  2771,  2252,  1909,  1659,  1469,  1323,  1206}, /* Q7s */
+    { 5602,  3854,  2973,  2433,  2073,  1807,  1607,  1447,  1320}, /* Q8s */
+    { 5766,  4065,  3185,  2638,  2264,  1982,  1761,  1591,  1453}, /* Q9s */
+    { 5947,  4314,  3454,  2904,  2515,  2223,  1991,  1806,  1655}, /* QTs */
+    { 6026,  4419,  3567,  3017,  2627,  2321,  2077,  1883,  1723}, /* QJs */
+    { 7993,  6495,  5351,  4474,  3787,  3254,  2831,  2493,  2220}, /* QQ */
+    { 6146,  4438,  3515,  2924,  2504,  2175,  1914,  1692,  1512}, /* KQo */
+    { 6443,  4682,  3683,  3045,  2591,  2243,  1970,  1739,  1556}, /* AQo */
+    { 5321,  3490,  2622,  2132,  1818,  1602,  1433,  1303,  1196}, /* K2s */
+    { 5405,  3569,  2683,  2185,  1858,  1629,  1457,  1322,  1210}, /* K3s */
+    { 5488,  3653,  2751,  2237,  1900,  1661,  1483,  1345,  1230}, /* K4s */
+    { 5579,  3743,  2828,  2299,  1949,  1705,  1515,  1367,  1249}, /* K5s */
+    { 5664,  3825,  2906,  2355,  2003,  1743,  1551,  1398,  1276}, /* K6s */
+    { 5754,  3925,  2993,  2434,  2067,  1799,  1599,  1441,  1314}, /* K7s */
+    { 5831,  4013,  3079,  2514,  2139,  1862,  1655,  1489,  1356}, /* K8s */
+    { 5999,  4228,  3291,  2718,  2323,  2030,  1809,  1633,  1483}, /* K9s */
+    { 6179,  4481,  3563,  2988,  2585,  2274,  2042,  1848,  1690}, /* KTs */
+    { 6257,  4588,  3688,  3108,  2694,  2381,  2133,  1931,  1761}, /* KJs */
+    { 6340,  4708,  3822,  3249,  2834,  2513,  2260,  2043,  1862}, /* KQs */
+    { 8240,  6881,  5819,  4974,  4297,  3743,  3293,  2915,  2609}, /* KK */
+    { 6532,  4821,  3853,  3232,  2786,  2438,  2152,  1924,  1725}, /* AKo */
+    { 5738,  3875,  2949,  2409,  2059,  1813,  1626,  1480,  1361}, /* A2s */
+    { 5822,  3962,  3019,  2473,  2118,  1866,  1672,  1519,  1396}, /* A3s */
+    { 5903,  4052,  3098,  2534,  2164,  1907,  1707,  1547,  1421}, /* A4s */
+    { 5992,  4143,  3173,  2600,  2219,  1946,  1740,  1579,  1445}, /* A5s */
+    { 5991,  4119,  3128,  2542,  2161,  1884,  1682,  1524,  1391}, /* A6s */
+    { 6098,  4240,  3245,  2640,  2243,  1957,  1734,  1566,  1428}, /* A7s */
+    { 6194,  4348,  3347,  2734,  2324,  2026,  1798,  1622,  1475}, /* A8s */
+    { 6278,  4452,  3449,  2830,  2414,  2102,  1870,  1688,  1538}, /* A9s */
+    { 6460,  4700,  3723,  3100,  2668,  2348,  2099,  1900,  1734}, /* ATs */
+    { 6539,  4823,  3844,  3225,  2783,  2459,  2202,  1992,  1816}, /* AJs */
+    { 6621,  4944,  3986,  3368,  2928,  2595,  2328,  2108,  1925}, /* AQs */
+    { 6704,  5073,  4145,  3538,  3108,  2772,  2494,  2263,  2068}, /* AKs */
+    { 8520,  7347,  6382,  5587,  4917,  4356,  3876,  3462,  3111}  /* AA */
+};
@@ -1,28 +1,351 @@
 <?php
 
+namespace {
+
 /**
- * Evaluate a 5- or 7-card poker hand.
+ * Evaluate a 5-, 6- or 7-card poker hand.
  *
- * @param string $hand Space-separated card codes (e.g. "Ah Kh Qh Jh Th").
+ * @param string|list<string|int>|int $hand Space-separated card codes (e.g. "Ah Kh Qh Jh Th"), a list of card strings or ids, or a card mask.
  * @return array{value:int, rank:int, name:string, cards:int}
+ * @throws Exception If a card is invalid or repeated, or there are not 5 to 7 cards.
+ */
+function poker_evaluate_hand(string|array|int $hand): array
+{
+}
+
+/**
+ * Evaluate many 5-, 6- or 7-card hands in one call.
+ *
+ * @param array<string|list<string|int>|int> $hands Card strings, lists of card strings or ids (suit * 13 + rank, suits c, d, h, s), or card masks.
+ * @return array{values:list<int>, ranks:list<int>} Results in input order.
+ * @throws Exception If any hand is invalid.
+ */
+function poker_evaluate_hands(array $hands): array
+{
+}
+
+/**
+ * Evaluate an Omaha hand: the best of exactly two hole cards and exactly three board cards.
+ *
+ * @param string|list<string|int>|int $hole 4 or 5 hole cards: card string, list of card strings or ids, or card mask.
+ * @param string|list<string|int>|int $board 3 to 5 board cards, in the same forms.
+ * @return array{value:int, rank:int, name:string, low:int} low is the ace-to-five eight-or-better low, 0 for none.
+ * @throws Exception If the cards are invalid or shared between hole and board.
+ */
+function poker_evaluate_omaha(string|array|int $hole, string|array|int $board): array
+{
+}
+
+/**
+ * Evaluate a 5-, 6- or 7-card short-deck (6+) hand: flushes beat full houses and A-6-7-8-9 is a straight.
+ *
+ * @param string|list<string|int>|int $hand Card string, list of card strings or ids, or card mask (six or higher).
+ * @return array{value:int, rank:int, name:string, cards:int}
+ * @throws Exception If a card is invalid, repeated or below six.
+ */
+function poker_evaluate_short_deck(string|array|int $hand): array
+{
+}
+
+/**
+ * Evaluate a lowball hand: the ace-to-five eight-or-better low, or deuce-to-seven lowball.
+ *
+ * @param string|list<string|int>|int $hand Card string, list of card strings or ids, or card mask (5-7 cards for ace_five, 5 for deuce_seven).
+ * @param 'ace_five'|'deuce_seven' $type Lowball type.
+ * @return array{value:int, name:string} Lower values are better; 0 means no ace-to-five low.
+ * @throws Exception If the hand or type is invalid.
+ */
+function poker_evaluate_low(string|array|int $hand, string $type = 'ace_five'): array
+{
+}
+
+/**
+ * Convert cards to card ids (suit * 13 + rank, suits c, d, h, s, ranks 2 = 0 to A = 12).
+ *
+ * @param string|list<string|int>|int $cards Card string, list of card strings or ids, or card mask.
+ * @return list<int>
+ * @throws Exception If a card is invalid.
+ */
+function poker_cards_to_ids(string|array|int $cards): array
+{
+}
+
+/**
+ * Convert cards to a 64-bit card mask (bit n set for card id n).
+ *
+ * @param string|list<string|int>|int $cards Card string, list of card strings or ids, or card mask.
+ * @return int
+ * @throws Exception If a card is invalid.
+ */
+function poker_cards_to_mask(string|array|int $cards): int
+{
+}
+
+/**
+ * Convert cards to a space-separated card string (e.g. "Ah Kd").
+ *
+ * @param string|list<string|int>|int $cards Card string, list of card strings or ids, or card mask.
+ * @return string
+ * @throws Exception If a card is invalid.
  */
-function poker_evaluate_hand(string $hand): array
+function poker_cards_to_string(string|array|int $cards): string
 {
 }
 
 /**
  * Calculate equity for multiple poker hands.
  *
- * @param list<string> $hole_cards Each player's hole cards (e.g. "Ah Ad").
- * @param list<string>|null $board_cards Optional board cards (0-5 cards).
- * @param int|null $iterations Optional number of iterations for Monte Carlo.
- * @param list<string>|null $dead_cards Optional dead cards to remove from the deck.
- * @return array<int, array{equity:float, wins:int, ties:int}>
+ * @param list<string|list<string|int>|int|\PHPoker\Range> $hole_cards Each player's hole cards (e.g. "Ah Ad", [38, 25] or a card mask; 4 or 5 cards in Omaha, "??" for a card dealt at random, Monte Carlo only) or hold'em hand range (e.g. "QQ+, AKs").
+ * @param list<string|int>|int|null $board_cards Optional board cards (0-5 cards): card strings or ids, or a card mask.
+ * @param int|null $iterations Optional number of iterations for Monte Carlo (the ceiling with precision or max_time).
+ * @param list<string|int>|int|null $dead_cards Optional dead cards to remove from the deck: card strings or ids, or a card mask.
+ * @param array{mode?:'auto'|'exact'|'monte_carlo', game?:'holdem'|'omaha'|'omaha5'|'shortdeck', hilo?:bool, precision?:float, max_time?:float, threads?:int, seed?:int, combos?:bool, categories?:bool, cache?:bool}|null $options Optional settings.
+ * @return array<int, array{equity:float, wins:int, ties:int, iterations?:int, std_error?:float, ci?:array{0:float, 1:float}, scoops?:int, high_only?:int, low_only?:int, partial_scoops?:int, categories?:array<string, array{hands:int, wins:int}>, combos?:array<string, array{equity:float, deals:int}>}>
  */
 function poker_calculate_equity(
     array $hole_cards,
-    ?array $board_cards = null,
+    array|int|null $board_cards = null,
     ?int $iterations = null,
-    ?array $dead_cards = null
+    array|int|null $dead_cards = null,
+    ?array $options = null
 ): array {
 }
+
+/**
+ * Every player's equity for each card that can come next on the flop or turn, and their outs.
+ *
+ * @param list<string|list<string|int>|int> $hole_cards Each player's hole cards.
+ * @param list<string|int>|int $board_cards The 3 or 4 board cards.
+ * @param list<string|int>|int|null $dead_cards Optional dead cards to remove from the deck.
+ * @param array{game?:'holdem'|'omaha'|'omaha5'|'shortdeck'}|null $options Optional settings.
+ * @return array{cards:list<string>, equity:list<list<float>>, outs:list<int>} Equity rows follow cards; outs are card masks.
+ * @throws Exception If the cards are invalid or the board is not a flop or a turn.
+ */
+function poker_calculate_runouts(
+    array $hole_cards,
+    array|int $board_cards,
+    array|int|null $dead_cards = null,
+    ?array $options = null
+): array {
+}
+
+/**
+ * Generate the Two Plus Two lookup table used by phpoker.evaluator=twoplustwo.
+ *
+ * @param string $path File to write (~130 MB).
+ * @return bool True on success.
+ * @throws Exception If the file cannot be written.
+ */
+function poker_generate_lookup_table(string $path): bool
+{
+}
+
+/**
+ * Generate the heads-up preflop equity table used by phpoker.preflop_table.
+ *
+ * Every suit-isomorphic matchup is enumerated over all boards, which takes
+ * over an hour on one core. A generated copy ships as data/preflop.bin.
+ *
+ * @param string $path File to write (~550 KB).
+ * @return bool True on success.
+ * @throws Exception If the file cannot be written.
+ */
+function poker_generate_preflop_table(string $path): bool
+{
+}
+
+/**
+ * Preflop equity of a starting hand against 1-9 random opponents.
+ *
+ * Served from a precomputed chart compiled into the extension. Equity is
+ * the hand's share of the pot, to two decimals.
+ *
+ * @param string $hand Starting hand class ("AKs", "T9o", "QQ", "AK") or two cards ("AhKh").
+ * @param int $opponents Number of random opponents (1-9).
+ * @return float Equity in percent.
+ * @throws Exception If the hand or the number of opponents is invalid.
+ */
+function poker_preflop_equity(string|array|int $hand, int $opponents = 1): float
+{
+}
+
+/**
+ * Generate the preflop equity chart compiled in as src/preflop_chart.h.
+ *
+ * Heads-up cells are exact when phpoker.preflop_table is loaded; the other
+ * cells are sampled. Rebuild the extension to pick up the new chart.
+ *
+ * @param string $path File to write.
+ * @param int $iterations Deals per sampled cell.
+ * @return bool True on success.
+ * @throws Exception If the file cannot be written.
+ */
+function poker_generate_preflop_chart(string $path, int $iterations = 4000000): bool
+{
+}
+
+/**
+ * Statistics of the per-process equity result cache (see phpoker.cache_size), and of the
+ * shared-memory one (see phpoker.shared_cache_size) under 'shared'.
+ *
+ * @return array{enabled:bool, capacity:int, entries:int, hits:int, misses:int, evictions:int, shared:array{enabled:bool, capacity:int, entries:int, hits:int, misses:int, evictions:int}}
+ */
+function poker_cache_stats(): array
+{
+}
+
+/**
+ * Empty the per-process equity result cache and reset its statistics.
+ *
+ * @return bool True, or false when the cache is disabled.
+ */
+function poker_cache_clear(): bool
+{
+}
+}
+
+namespace PHPoker {
+
+/**
+ * A hand range: a set of two-card combos, each with a weight between 0 and 1.
+ *
+ * Ranges are immutable; every operation returns a new range. Iterating yields
+ * combo name (e.g. "AsAc") => weight.
+ *
+ * @implements \IteratorAggregate<string, float>
+ */
+final class Range implements \IteratorAggregate, \Countable
+{
+    /**
+     * @param string $range Range notation (e.g. "QQ+, AKs, T9s-76s, AhKh:0.5").
+     * @throws \Exception If the notation is invalid.
+     */
+    public function __construct(string $range = '')
+    {
+    }
+
+    /** Combos in either range; combos in both keep this range's weight. */
+    public function union(Range $other): Range
+    {
+    }
+
+    /** Combos in both ranges, with this range's weights. */
+    public function intersect(Range $other): Range
+    {
+    }
+
+    /** Combos in this range but not in the other. */
+    public function subtract(Range $other): Range
+    {
+    }
+
+    /**
+     * Remove every combo that uses one of the given cards.
+     *
+     * @param int|string $cards 64-bit card mask (bit suit * 13 + rank, suits ordered c, d, h, s) or cards (e.g. "Ah Kd 2c").
+     */
+    public function removeCards(int|string|array $cards): Range
+    {
+    }
+
+    /**
+     * Set the weight of some or all combos (0 removes them).
+     *
+     * @param string|Range|null $combos Combos to weight, all of them when null.
+     */
+    public function withWeight(float $weight, string|Range|null $combos = null): Range
+    {
+    }
+
+    /** Weight of one combo (e.g. "AhKd"), 0 when it is not in the range. */
+    public function weight(string $combo): float
+    {
+    }
+
+    public function contains(string $combo): bool
+    {
+    }
+
+    /** Number of combos. */
+    public function count(): int
+    {
+    }
+
+    /** Sum of the combo weights. */
+    public function weightedCount(): float
+    {
+    }
+
+    /** @return array<string, float> */
+    public function toArray(): array
+    {
+    }
+
+    /** @return \Iterator<string, float> */
+    public function getIterator(): \Iterator
+    {
+    }
+}
+
+/**
+ * An equity calculation that is parsed and checked once, then followed card
+ * by card as the hand goes on.
+ *
+ * Flop and turn enumerations are kept broken down by the next card, so the
+ * calculation after addBoardCard() is answered from them without dealing.
+ */
+final class EquityCalculator
+{
+    /**
+     * @param array $hole_cards Each player's hole cards or hand range, as for poker_calculate_equity().
+     * @param array|int|null $board_cards Board cards dealt so far, or a card mask.
+     * @param array|int|null $dead_cards Cards that are no longer in the deck, or a card mask.
+     * @param array|null $options Same options as poker_calculate_equity().
+     * @throws \Exception If the cards or options are invalid.
+     */
+    public function __construct(array $hole_cards, array|int|null $board_cards = null, array|int|null $dead_cards = null, ?array $options = null)
+    {
+    }
+
+    /**
+     * Deal the next board card.
+     *
+     * @param string|int $card Card string (e.g. "Ah") or card id.
+     * @throws \Exception If the card is invalid, already in play, or the board is full.
+     */
+    public function addBoardCard(string|int $card): EquityCalculator
+    {
+    }
+
+    /**
+     * Take a card out of the deck.
+     *
+     * @param string|int $card Card string (e.g. "Ah") or card id.
+     * @throws \Exception If the card is invalid or already in play.
+     */
+    public function addDeadCard(string|int $card): EquityCalculator
+    {
+    }
+
+    /**
+     * Equity with the cards so far.
+     *
+     * @param int $iterations Iterations, as for poker_calculate_equity() (0 for the default).
+     * @return array<int, array{equity: float, wins: int, ties: int}> Same as poker_calculate_equity().
+     */
+    public function calculate(int $iterations = 0): array
+    {
+    }
+
+    /** @return list<string> Board cards dealt so far. */
+    public function board(): array
+    {
+    }
+
+    /** @return list<string> Dead cards so far. */
+    public function deadCards(): array
+    {
+    }
+}
+
+}
@@ -39,7 +39,24 @@ expect()->extend('toBeOne', function () {
 |
 */
 
-function something()
+/**
+ * Run PHP code in a new process with extra ini settings and decode the JSON
+ * it echoes. The phpoker table and cache settings are PHP_INI_SYSTEM, so the
+ * tests that need them set them on a process of their own.
+ */
+function phpoker_run(array $ini, string $code): mixed
 {
-    // ..
+    $command = escapeshellarg(PHP_BINARY);
+
+    if (php_ini_loaded_file() !== false) {
+        $command .= ' -c ' . escapeshellarg(php_ini_loaded_file());
+    }
+
+    foreach (['display_errors' => 'stderr'] + $ini as $name => $value) {
+        $command .= ' -d ' . escapeshellarg($name . '=' . $value);
+    }
+
+    $output = shell_exec($command . ' -r ' . escapeshellarg($code));
+
+    return json_decode((string) $output, true, 512, JSON_THROW_ON_ERROR);
 }
@@ -0,0 +1,180 @@
+<?php
+
+test('has the result cache functions', function () {
+    expect(function_exists('poker_cache_stats'))->toBeTrue();
+    expect(function_exists('poker_cache_clear'))->toBeTrue();
+});
+
+test('reports the result cache statistics', function () {
+    $stats = poker_cache_stats();
+
+    expect($stats)->toHaveKeys(['enabled', 'capacity', 'entries', 'hits', 'misses', 'evictions']);
+    expect($stats['enabled'])->toBe((int) ini_get('phpoker.cache_size') > 0);
+    expect($stats['entries'])->toBeLessThanOrEqual($stats['capacity']);
+});
+
+test('reports the shared result cache statistics', function () {
+    $shared = poker_cache_stats()['shared'];
+
+    expect($shared)->toHaveKeys(['enabled', 'capacity', 'entries', 'hits', 'misses', 'evictions']);
+    expect($shared['enabled'])->toBe((int) ini_get('phpoker.shared_cache_size') > 0);
+    expect($shared['entries'])->toBeLessThanOrEqual($shared['capacity']);
+});
+
+test('gives the same result for suit renamings and seat orders', function () {
+    // Answered from the cache or calculated, the counters follow each player
+    $result = poker_calculate_equity(['Ah Kh', '7c 7d', 'Qs Js'], ['2h', '8h', 'Tc'], 0, ['3d'], ['mode' => 'exact']);
+    $mirrored = poker_calculate_equity(['Qh Jh', 'As Ks', '7c 7d'], ['2s', '8s', 'Tc'], 0, ['3d'], ['mode' => 'exact']);
+
+    expect($mirrored[1]['wins'])->toBe($result[0]['wins']);
+    expect($mirrored[2]['wins'])->toBe($result[1]['wins']);
+    expect($mirrored[0]['wins'])->toBe($result[2]['wins']);
+    expect($mirrored[0]['ties'])->toBe($result[2]['ties']);
+});
+
+test('bypasses the cache when asked to', function () {
+    $cached = poker_calculate_equity(['Ah Kd', 'Qc Qs'], ['2c', '7d', '9h'], 0, null, ['mode' => 'exact']);
+    $fresh = poker_calculate_equity(['Ah Kd', 'Qc Qs'], ['2c', '7d', '9h'], 0, null, ['mode' => 'exact', 'cache' => false]);
+
+    expect($fresh)->toBe($cached);
+});
+
+test('answers repeated scenarios from the cache and evicts the least recently used', function () {
+    $result = phpoker_run(['phpoker.cache_size' => 2, 'phpoker.shared_cache_size' => 0], '
+        $equity = fn(array $hands, string $board) => poker_calculate_equity($hands, explode(" ", $board), 0, null, ["mode" => "exact"]);
+        $stored = $equity(["Qs Qc", "Ad Kd"], "2d 7d 9h");
+        $hit = $equity(["Ah Kh", "Qd Qc"], "2h 7h 9s");
+        $stats = [poker_cache_stats()];
+        $equity(["Jh Jd", "Ac Kc"], "2d 7d 9h");
+        $equity(["Qd Qc", "Ah Kh"], "2h 7h 9s"); // AKs vs QQ is now the most recently used
+        $equity(["Th Td", "Ac Kc"], "2d 7d 9h"); // evicts JJ vs AKs
+        $stats[] = poker_cache_stats();
+        $equity(["Jh Jd", "Ac Kc"], "2d 7d 9h"); // calculated again, evicts AKs vs QQ
+        $equity(["Th Td", "Ac Kc"], "2d 7d 9h");
+        $stats[] = poker_cache_stats();
+        $equity(["Qs Qc", "Ad Kd"], "2d 7d 9h");
+        $stats[] = poker_cache_stats();
+        echo json_encode(["stored" => $stored, "hit" => $hit, "stats" => $stats]);
+    ');
+
+    // The hit comes back in the caller's seat order
+    expect($result['hit'][0])->toBe($result['stored'][1]);
+    expect($result['hit'][1])->toBe($result['stored'][0]);
+
+    $counts = array_map(fn($stats) => [$stats['entries'], $stats['hits'], $stats['misses'], $stats['evictions']], $result['stats']);
+
+    expect($result['stats'][0]['capacity'])->toBe(2);
+    expect($counts)->toBe([[1, 1, 1, 0], [2, 2, 3, 1], [2, 3, 4, 2], [2, 3, 5, 3]]);
+});
+
+test('calculates seeded simulations every time', function () {
+    $result = phpoker_run(['phpoker.cache_size' => 4, 'phpoker.shared_cache_size' => 0], '
+        $equity = fn(array $hands, array $options = []) => poker_calculate_equity($hands, [], 10000, null, ["mode" => "monte_carlo", "seed" => 11] + $options);
+        $equity(["Qs Qc", "Ad Kd"]);
+        $renamed = $equity(["Qd Qc", "Ah Kh"]);
+        $fresh = $equity(["Qd Qc", "Ah Kh"], ["cache" => false]);
+        echo json_encode(["renamed" => $renamed, "fresh" => $fresh, "stats" => poker_cache_stats()]);
+    ');
+
+    // A suit renaming draws other samples, so it must not reuse the first result
+    expect($result['renamed'])->toBe($result['fresh']);
+    expect([$result['stats']['entries'], $result['stats']['hits'], $result['stats']['misses']])->toBe([0, 0, 0]);
+});
+
+test('replaces the least recently read result of a full shared set', function () {
+    // Eight slots make a single 8-way set
+    $stats = phpoker_run(['phpoker.cache_size' => 0, 'phpoker.shared_cache_size' => 8, 'phpoker.shared_cache_ttl' => 3600], '
+        $equity = fn(string $board) => poker_calculate_equity(["Ah Kd", "Qc Qs"], explode(" ", $board), 0, null, ["mode" => "exact"]);
+        $boards = ["2c 7d 9h", "3c 7d 9h", "4c 7d 9h", "5c 7d 9h", "6c 7d 9h", "8c 7d 9h", "Tc 7d 9h", "Jc 7d 9h", "2c 3d 9h"];
+        foreach (array_slice($boards, 0, 8) as $board) {
+            $equity($board);
+        }
+        $stats = [poker_cache_stats()["shared"]];
+        sleep(1);
+        $equity($boards[0]); // read last, so it stays
+        $equity($boards[8]); // replaces the second board
+        $equity($boards[0]);
+        $stats[] = poker_cache_stats()["shared"];
+        $equity($boards[1]); // calculated again, replaces the third board
+        $stats[] = poker_cache_stats()["shared"];
+        echo json_encode($stats);
+    ');
+
+    $counts = array_map(fn($shared) => [$shared['entries'], $shared['hits'], $shared['misses'], $shared['evictions']], $stats);
+
+    expect($stats[0]['capacity'])->toBe(8);
+    expect($counts)->toBe([[8, 0, 8, 0], [8, 2, 9, 1], [8, 2, 10, 2]]);
+});
+
+test('expires shared results after phpoker.shared_cache_ttl', function () {
+    $result = phpoker_run(['phpoker.cache_size' => 0, 'phpoker.shared_cache_size' => 64, 'phpoker.shared_cache_ttl' => 1], '
+        $equity = fn() => poker_calculate_equity(["Ah Kd", "Qc Qs"], ["2c", "7d", "9h"], 0, null, ["mode" => "exact"]);
+        // Start on a fresh second, so the result is read back before it expires
+        for ($second = time(); time() === $second; usleep(1000));
+        $first = $equity();
+        $equity();
+        $stats = [poker_cache_stats()["shared"]];
+        sleep(2);
+        $again = $equity(); // expired: calculated again and stored in the same slot
+        $stats[] = poker_cache_stats()["shared"];
+        $equity();
+        $stats[] = poker_cache_stats()["shared"];
+        echo json_encode(["same" => $again === $first, "stats" => $stats]);
+    ');
+
+    $counts = array_map(fn($shared) => [$shared['entries'], $shared['hits'], $shared['misses'], $shared['evictions']], $result['stats']);
+
+    expect($result['same'])->toBeTrue();
+    expect($counts)->toBe([[1, 1, 1, 0], [1, 1, 2, 0], [1, 2, 2, 0]]);
+});
+
+test('copies shared hits into the process cache', function () {
+    $result = phpoker_run(['phpoker.cache_size' => 4, 'phpoker.shared_cache_size' => 64, 'phpoker.shared_cache_ttl' => 3600], '
+        $equity = fn(array $hands, array $board) => poker_calculate_equity($hands, $board, 0, null, ["mode" => "exact"]);
+        $first = $equity(["Ah Kd", "Jc Js"], ["2c", "7d", "9h"]);
+        poker_cache_clear(); // empties this process cache only
+        $shared = $equity(["Jd Jh", "As Kc"], ["2d", "7c", "9s"]);
+        $local = $equity(["Jd Jh", "As Kc"], ["2d", "7c", "9s"]);
+        $stats = poker_cache_stats();
+        echo json_encode(["first" => $first, "shared" => $shared, "local" => $local, "stats" => $stats]);
+    ');
+
+    $local = $result['stats'];
+    $shared = $result['stats']['shared'];
+
+    expect($result['shared'][0])->toBe($result['first'][1]);
+    expect($result['shared'][1])->toBe($result['first'][0]);
+    expect($result['local'])->toBe($result['shared']);
+    expect([$local['entries'], $local['hits'], $local['misses']])->toBe([1, 1, 1]);
+    expect([$shared['entries'], $shared['hits'], $shared['misses']])->toBe([1, 1, 1]);
+});
+
+test('shares results with forked processes', function () {
+    $shared = phpoker_run(['phpoker.cache_size' => 0, 'phpoker.shared_cache_size' => 64, 'phpoker.shared_cache_ttl' => 3600], '
+        $equity = fn() => poker_calculate_equity(["Ah Kd", "Qc Qs"], ["2c", "7d", "9h"], 0, null, ["mode" => "exact"]);
+        if (($pid = pcntl_fork()) === 0) {
+            $equity();
+            exit(0);
+        }
+        pcntl_waitpid($pid, $status);
+        $equity();
+        echo json_encode(poker_cache_stats()["shared"]);
+    ');
+
+    // The child stored it, the parent read it
+    expect([$shared['entries'], $shared['hits'], $shared['misses']])->toBe([1, 1, 1]);
+})->skip(!function_exists('pcntl_fork'), 'needs the pcntl extension');
+
+test('clears the cache only when it is enabled', function () {
+    $code = 'echo json_encode([poker_calculate_equity(["Ah Kd", "Qc Qs"], ["2c", "7d", "9h"], 0), poker_cache_clear(), poker_cache_stats()]);';
+
+    [, $cleared, $stats] = phpoker_run(['phpoker.cache_size' => 4], $code);
+
+    expect($cleared)->toBeTrue();
+    expect([$stats['entries'], $stats['hits'], $stats['misses']])->toBe([0, 0, 0]);
+
+    [, $cleared, $stats] = phpoker_run(['phpoker.cache_size' => 0], $code);
+
+    expect($cleared)->toBeFalse();
+    expect($stats['enabled'])->toBeFalse();
+});
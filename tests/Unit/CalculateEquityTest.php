@@ -66,6 +66,115 @@ test('equity preflop 99 vs AK without dead cards', function () use ($iterations,
     assert_equity($result, 1, 45.1, $margin);
 });
 
+test('exact mode counts every turn runout', function () {
+    $result = poker_calculate_equity(['Jh Jd', 'As Td', '7h 8h'], ['Kc', '9d', '6s', 'Tc'], 0, null, ['mode' => 'exact']);
+
+    expect($result[0]['wins'] + $result[1]['wins'] + $result[2]['wins'])->toBe(42);
+    expect($result[2]['wins'])->toBe(38);
+});
+
+test('exact mode preflop AA vs KK', function () {
+    $result = poker_calculate_equity(['Ah Ad', 'Kh Kd'], [], 0, null, ['mode' => 'exact']);
+
+    expect($result[0]['wins'] + $result[1]['wins'] + $result[0]['ties'])->toBe(1712304);
+    expect(round($result[0]['equity'], 4))->toBe(82.6366);
+    expect(round($result[1]['equity'], 4))->toBe(17.3634);
+});
+
+test('exact mode matches monte carlo', function () use ($iterations, $margin) {
+    $exact = poker_calculate_equity(['9h 9d', 'Ad Kh'], [], 0, ['As'], ['mode' => 'exact']);
+    $sampled = poker_calculate_equity(['9h 9d', 'Ad Kh'], [], $iterations, ['As'], ['mode' => 'monte_carlo']);
+
+    assert_equity($sampled, 0, $exact[0]['equity'], $margin);
+    assert_equity($sampled, 1, $exact[1]['equity'], $margin);
+});
+
+test('auto mode enumerates small board counts', function () {
+    $result = poker_calculate_equity(['Ah Kd', '2c 2h'], ['Kc', '7d', '2s'], 100);
+
+    expect($result[0]['wins'] + $result[1]['wins'] + $result[0]['ties'])->toBe(990);
+});
+
+test('invalid equity mode throws', function () {
+    expect(fn() => poker_calculate_equity(['Ah Ad', 'Kh Kd'], [], 1000, null, ['mode' => 'fast']))
+        ->toThrow(Exception::class, 'Invalid equity mode (need auto, exact or monte_carlo)');
+});
+
+test('seeded results do not depend on the thread count', function () {
+    $hands = ['Ah Ad', 'Kh Kd', 'Qs Qc', 'Jh Th'];
+    $single = poker_calculate_equity($hands, [], 100000, null, ['seed' => 42, 'threads' => 1]);
+    $multi = poker_calculate_equity($hands, [], 100000, null, ['seed' => 42, 'threads' => 4]);
+
+    expect($multi)->toBe($single);
+});
+
+test('seeded results are reproducible', function () {
+    $first = poker_calculate_equity(['9h 9d', 'Ad Kh'], [], 50000, null, ['seed' => 7, 'threads' => 2]);
+    $second = poker_calculate_equity(['9h 9d', 'Ad Kh'], [], 50000, null, ['seed' => 7, 'threads' => 2]);
+
+    expect($second)->toBe($first);
+});
+
+test('different seeds draw different samples', function () {
+    $first = poker_calculate_equity(['9h 9d', 'Ad Kh'], [], 50000, null, ['seed' => 1]);
+    $second = poker_calculate_equity(['9h 9d', 'Ad Kh'], [], 50000, null, ['seed' => 2]);
+
+    expect($second)->not->toBe($first);
+});
+
+test('multithreaded equity preflop AA vs KK', function () use ($iterations, $margin) {
+    $result = poker_calculate_equity(['Ah Ad', 'Kh Kd'], [], $iterations, null, ['mode' => 'monte_carlo', 'threads' => 4]);
+
+    assert_equity($result, 0, 82.6, $margin);
+    assert_equity($result, 1, 17.3, $margin);
+});
+
+test('equity AA vs a KK range matches the fixed hand', function () use ($iterations, $margin) {
+    $result = poker_calculate_equity(['Ah Ad', 'KK'], [], $iterations);
+
+    expect($result)->toBeArray()->toHaveCount(2);
+    assert_equity($result, 0, 82.6, $margin);
+    assert_equity($result, 1, 17.3, $margin);
+});
+
+test('range combos are removed by the board and other players', function () {
+    $result = poker_calculate_equity(['Ah Kh', 'AA, KK'], ['Ad', 'Kd', '2c'], 10000, null, ['combos' => true]);
+
+    expect($result[1]['combos'])->toHaveCount(2);
+    expect($result[1]['combos'])->toHaveKeys(['AsAc', 'KsKc']);
+});
+
+test('range notation covers plus, dash and weights', function () {
+    $result = poker_calculate_equity(['2c 2d', 'QQ+, AKs, T9s-76s, 65o:0.5'], [], 10000, null, ['combos' => true]);
+
+    // 18 pairs + 4 AKs + 16 suited connectors + 12 65o, minus the none blocked by 22
+    expect($result[1]['combos'])->toHaveCount(50);
+});
+
+test('per combo equity is reported for each range player', function () {
+    $result = poker_calculate_equity(['Ah Ad', 'KK, QJs'], [], 200000, null, ['combos' => true, 'seed' => 3]);
+
+    $deals = array_sum(array_column($result[1]['combos'], 'deals'));
+    expect($deals)->toBe(200000);
+    expect($result[1]['combos']['KsKc']['equity'])->toBeGreaterThan(15.0)->toBeLessThan(20.0);
+    expect(isset($result[0]['combos']))->toBeFalse();
+});
+
+test('invalid hand ranges throw', function () {
+    expect(fn() => poker_calculate_equity(['Ah Ad', 'QQ-'], [], 1000))
+        ->toThrow(Exception::class, 'Invalid hand range');
+});
+
+test('hand ranges without possible combos throw', function () {
+    expect(fn() => poker_calculate_equity(['Ah Ad', 'AA'], ['As'], 1000))
+        ->toThrow(Exception::class, 'Hand range has no combos left after card removal');
+});
+
+test('exact mode rejects hand ranges', function () {
+    expect(fn() => poker_calculate_equity(['Ah Ad', 'KK'], [], 1000, null, ['mode' => 'exact']))
+        ->toThrow(Exception::class, 'Exact mode does not support hand ranges');
+});
+
 test('dead cards reduce deck availability', function () use ($iterations) {
     $ranks = ['2', '3', '4', '5', '6', '7', '8', '9', 'T', 'J', 'Q', 'K', 'A'];
     $suits = ['c', 'd', 'h', 's'];
@@ -85,3 +194,134 @@ test('dead cards reduce deck availability', function () use ($iterations) {
     expect(fn() => poker_calculate_equity(['9h 9d', 'Ad Kh'], [], $iterations, $dead))
         ->toThrow(Exception::class, 'Not enough cards left in deck after removing used/dead cards');
 });
+
+test('rejects duplicate cards between players, board and dead cards', function ($hole, $board, $dead, $message) {
+    expect(fn() => poker_calculate_equity($hole, $board, 1000, $dead))
+        ->toThrow(Exception::class, $message);
+})->with([
+    'same card twice in one hand' => [['Ah Ah', 'Kd Kc'], null, null, 'Duplicate hole card found'],
+    'card shared by two players' => [['Ah Kd', 'Ah Qc'], null, null, 'Duplicate hole card found'],
+    'board card in a hand' => [['Ah Kd', 'Qs Qc'], ['Ah', '7c', '2d'], null, 'Duplicate card found on board'],
+    'board card twice' => [['Ah Kd', 'Qs Qc'], ['7c', '7c', '2d'], null, 'Duplicate card found on board'],
+    'dead card on the board' => [['Ah Kd', 'Qs Qc'], ['7c', '8c', '2d'], ['8c'], 'Dead card already in use by player or on board'],
+    'dead card twice' => [['Ah Kd', 'Qs Qc'], null, ['3s', '3s'], 'Dead card already in use by player or on board'],
+]);
+
+test('stops once every player reaches the target precision', function () {
+    $result = poker_calculate_equity(['Ah Ad', 'Kh Kd'], [], 0, null, ['precision' => 0.5, 'seed' => 42]);
+
+    foreach ($result as $player) {
+        expect($player)->toHaveKeys(['iterations', 'std_error', 'ci']);
+        expect($player['std_error'])->toBeLessThanOrEqual(0.5);
+        expect($player['ci'][0])->toBeLessThan($player['equity']);
+        expect($player['ci'][1])->toBeGreaterThan($player['equity']);
+    }
+
+    // Far fewer than the 1,000,000 iteration ceiling
+    expect($result[0]['iterations'])->toBeLessThan(100000);
+    expect($result[0]['wins'] + $result[0]['ties'] + $result[1]['wins'])->toBe($result[0]['iterations']);
+});
+
+test('runs more iterations for a tighter target', function () {
+    $loose = poker_calculate_equity(['Ah Kd', 'Qc Qs'], [], 0, null, ['precision' => 1.0, 'seed' => 7]);
+    $tight = poker_calculate_equity(['Ah Kd', 'Qc Qs'], [], 0, null, ['precision' => 0.2, 'seed' => 7]);
+
+    expect($tight[0]['iterations'])->toBeGreaterThan($loose[0]['iterations']);
+    expect($tight[0]['std_error'])->toBeLessThanOrEqual(0.2);
+});
+
+test('keeps adaptive results reproducible across thread counts', function () {
+    $single = poker_calculate_equity(['Ah Kd', 'Qc Qs', '7h 6h'], [], 0, null, ['precision' => 0.3, 'seed' => 3, 'threads' => 1]);
+    $multi = poker_calculate_equity(['Ah Kd', 'Qc Qs', '7h 6h'], [], 0, null, ['precision' => 0.3, 'seed' => 3, 'threads' => 4]);
+
+    expect($multi)->toBe($single);
+});
+
+test('respects the iteration ceiling in precision mode', function () {
+    $result = poker_calculate_equity(['Ah Kd', 'Qc Qs'], [], 5000, null, ['precision' => 0.01, 'seed' => 1]);
+
+    expect($result[0]['iterations'])->toBe(5000);
+    expect($result[0]['std_error'])->toBeGreaterThan(0.01);
+});
+
+test('reports no sampling error for exact results', function () {
+    $result = poker_calculate_equity(['Ah Kd', 'Qc Qs'], ['2c', '7d', '9h'], 0, null, ['precision' => 0.5]);
+
+    expect($result[0]['std_error'])->toBe(0.0);
+    expect($result[0]['ci'])->toBe([$result[0]['equity'], $result[0]['equity']]);
+    expect($result[0]['iterations'])->toBe(990);
+});
+
+test('stops at the time budget with the iterations run so far', function () {
+    $result = poker_calculate_equity(['Ah Kd', 'Qc Qs'], [], 1000000, null, ['max_time' => 0.000001, 'seed' => 5]);
+
+    expect($result[0]['iterations'])->toBeGreaterThan(0);
+    expect($result[0]['iterations'])->toBeLessThan(1000000);
+    expect($result[0]['wins'] + $result[1]['wins'] + $result[0]['ties'])->toBe($result[0]['iterations']);
+    expect($result[0]['std_error'])->toBeGreaterThan(0.0);
+});
+
+test('runs every iteration when the time budget is not reached', function () {
+    $result = poker_calculate_equity(['Ah Kd', 'Qc Qs'], [], 5000, null, ['max_time' => 60, 'seed' => 5]);
+
+    expect($result[0]['iterations'])->toBe(5000);
+});
+
+test('rejects a max time that is not positive', function () {
+    expect(fn() => poker_calculate_equity(['Ah Kd', 'Qc Qs'], [], 0, null, ['max_time' => 0]))
+        ->toThrow(Exception::class, 'Max time must be a positive number of seconds');
+});
+
+test('rejects a precision that is not positive', function () {
+    expect(fn() => poker_calculate_equity(['Ah Kd', 'Qc Qs'], [], 0, null, ['precision' => 0]))
+        ->toThrow(Exception::class, 'Precision must be a positive standard error in percentage points');
+});
+
+test('counts final and winning hand categories', function () {
+    $result = poker_calculate_equity(['Ah Kh', '7c 7d', 'Qs Js'], ['2h', '8h', 'Tc'], 0, null, ['mode' => 'exact', 'categories' => true]);
+    $sevens = $result[1]['categories'];
+
+    expect(array_keys($sevens))->toBe(['Straight Flush', 'Four of a Kind', 'Full House', 'Flush', 'Straight',
+        'Three of a Kind', 'Two Pair', 'One Pair', 'High Card']);
+    expect(array_sum(array_column($sevens, 'hands')))->toBe(903);
+    expect($sevens['Four of a Kind'])->toBe(['hands' => 1, 'wins' => 1]);
+    expect($sevens['Three of a Kind'])->toBe(['hands' => 64, 'wins' => 22]);
+    expect($sevens['Two Pair'])->toBe(['hands' => 357, 'wins' => 123]);
+    expect($result[0]['categories']['Flush'])->toBe(['hands' => 342, 'wins' => 329]);
+});
+
+test('counts hand categories in the same Monte Carlo pass', function () {
+    $result = poker_calculate_equity(['Ah Kh', '7c 7d'], [], 20000, null, ['mode' => 'monte_carlo', 'seed' => 9, 'categories' => true]);
+
+    foreach ($result as $player) {
+        expect(array_sum(array_column($player['categories'], 'hands')))->toBe(20000);
+        expect(array_sum(array_column($player['categories'], 'wins')))->toBe($player['wins'] + $player['ties']);
+    }
+});
+
+test('deals unknown hole cards at random', function () {
+    $result = poker_calculate_equity(['Ah As', '?? ??'], [], 100000, null, ['seed' => 3]);
+
+    expect($result[0]['equity'])->toBeGreaterThan(84.2);
+    expect($result[0]['equity'])->toBeLessThan(86.2);
+
+    $result = poker_calculate_equity(['Ah As', '?? ??', '?? ??', '?? ??'], [], 100000, null, ['seed' => 3]);
+
+    expect($result[0]['equity'])->toBeGreaterThan(62.5);
+    expect($result[0]['equity'])->toBeLessThan(65.5);
+});
+
+test('reads unknown cards in card strings and card lists', function () {
+    $options = ['seed' => 5, 'cache' => false];
+
+    expect(poker_calculate_equity([['Ah', '??'], 'Kd Kc'], ['Kh', '7c', '2s'], 20000, null, $options))
+        ->toBe(poker_calculate_equity(['Ah ??', 'Kd Kc'], ['Kh', '7c', '2s'], 20000, null, $options));
+    expect(poker_calculate_equity(['Ah Kh Qd Jd', '?? ?? ?? ??'], [], 5000, null, ['game' => 'omaha']))->toHaveCount(2);
+});
+
+test('exact mode rejects unknown hole cards', function () {
+    expect(fn() => poker_calculate_equity(['Ah Ad', '?? ??'], [], 1000, null, ['mode' => 'exact']))
+        ->toThrow(Exception::class, 'Exact mode does not support unknown hole cards');
+    expect(fn() => poker_calculate_equity(['Ah Ad', '??'], [], 1000))
+        ->toThrow(Exception::class, 'Each player must have exactly 2 hole cards');
+});
@@ -0,0 +1,77 @@
+<?php
+
+test('has the card encoding functions', function () {
+    expect(function_exists('poker_cards_to_ids'))->toBeTrue();
+    expect(function_exists('poker_cards_to_mask'))->toBeTrue();
+    expect(function_exists('poker_cards_to_string'))->toBeTrue();
+});
+
+test('converts between card strings, ids and masks', function () {
+    expect(poker_cards_to_ids('2c Ad Ah As'))->toBe([0, 25, 38, 51]);
+    expect(poker_cards_to_mask('2c As'))->toBe(1 | 1 << 51);
+    expect(poker_cards_to_string([38, 37]))->toBe('Ah Kh');
+    expect(poker_cards_to_string(1 << 51 | 1))->toBe('2c As');
+    expect(poker_cards_to_ids(poker_cards_to_mask('Ah Kh')))->toBe([37, 38]);
+    expect(poker_cards_to_string(0))->toBe('');
+});
+
+test('round-trips every card', function () {
+    foreach (range(0, 51) as $id) {
+        $card = poker_cards_to_string([$id]);
+
+        expect(poker_cards_to_ids($card))->toBe([$id]);
+        expect(poker_cards_to_mask($card))->toBe(1 << $id);
+    }
+});
+
+test('rejects invalid cards', function ($cards) {
+    expect(fn() => poker_cards_to_ids($cards))->toThrow(Exception::class, 'Invalid card format');
+})->with([
+    'bad string' => ['Ah Xx'],
+    'id too large' => [[52]],
+    'negative id' => [[-1]],
+    'mask above 52 bits' => [1 << 52],
+]);
+
+test('evaluates hands given as ids or masks', function () {
+    $expected = poker_evaluate_hand('Ah Kh Qh Jh Th');
+
+    expect(poker_evaluate_hand([38, 37, 36, 35, 34]))->toBe($expected);
+    expect(poker_evaluate_hand(poker_cards_to_mask('Ah Kh Qh Jh Th')))->toBe($expected);
+    expect(poker_evaluate_hand(['Ah', 'Kh', 'Qh', 'Jh', 'Th']))->toBe($expected);
+    expect(poker_evaluate_hands([poker_cards_to_mask('Ah Kh Qh Jh Th')])['values'])->toBe([1]);
+});
+
+test('calculates equity from ids and masks', function () {
+    $options = ['mode' => 'exact'];
+    $expected = poker_calculate_equity(['Ah Ad', 'Kh Kd'], ['2c', '7d', 'Ts'], 10000, ['3s'], $options);
+
+    $fromIds = poker_calculate_equity([[38, 25], [37, 24]], [0, 18, 47], 10000, [40], $options);
+    $fromMasks = poker_calculate_equity(
+        [poker_cards_to_mask('Ah Ad'), poker_cards_to_mask('Kh Kd')],
+        poker_cards_to_mask('2c 7d Ts'),
+        10000,
+        poker_cards_to_mask('3s'),
+        $options
+    );
+
+    expect($fromIds)->toBe($expected);
+    expect($fromMasks)->toBe($expected);
+});
+
+test('rejects invalid hole cards given as ids', function () {
+    expect(fn() => poker_calculate_equity([[38, 52], 'Kh Kd']))
+        ->toThrow(Exception::class, 'Invalid hole card format');
+    expect(fn() => poker_calculate_equity([[38, 25, 24], 'Kh Kc']))
+        ->toThrow(Exception::class, 'Each player must have exactly 2 hole cards');
+});
+
+test('accepts ids and masks for preflop lookups and range card removal', function () {
+    expect(poker_preflop_equity([38, 37]))->toBe(poker_preflop_equity('AKs'));
+    expect(poker_preflop_equity(poker_cards_to_mask('Ah Kd')))->toBe(poker_preflop_equity('AKo'));
+
+    $range = new PHPoker\Range('AA');
+
+    expect($range->removeCards([38])->count())->toBe(3);
+    expect($range->removeCards(poker_cards_to_mask('Ah'))->count())->toBe(3);
+});
@@ -0,0 +1,100 @@
+<?php
+
+use PHPoker\EquityCalculator;
+
+test('has the EquityCalculator class', function () {
+    expect(class_exists(EquityCalculator::class))->toBeTrue();
+});
+
+test('matches poker_calculate_equity on the flop', function () {
+    $hands = ['Ah Kh', '7c 7d', 'Qs Js'];
+    $board = ['2h', '8h', 'Tc'];
+
+    $calc = new EquityCalculator($hands, $board);
+
+    expect($calc->calculate())->toBe(poker_calculate_equity($hands, $board, 10000, null, ['cache' => false]));
+});
+
+test('narrows the flop enumeration to the dealt turn and river', function () {
+    $hands = ['Ah Kh', '7c 7d', 'Qs Js'];
+
+    $calc = new EquityCalculator($hands, ['2h', '8h', 'Tc']);
+    $calc->calculate();
+
+    $turn = $calc->addBoardCard('3s')->calculate();
+    expect($turn)->toBe(poker_calculate_equity($hands, ['2h', '8h', 'Tc', '3s'], 10000, null, ['cache' => false]));
+
+    $river = $calc->addBoardCard('Qh')->calculate();
+    expect($river)->toBe(poker_calculate_equity($hands, ['2h', '8h', 'Tc', '3s', 'Qh'], 10000, null, ['cache' => false]));
+    expect($river[0]['wins'])->toBe(1);
+});
+
+test('drops a dead river from the turn enumeration', function () {
+    $hands = ['Ah Kh', '7c 7d'];
+    $board = ['2h', '8h', 'Tc', '3s'];
+
+    $calc = new EquityCalculator($hands, $board);
+    $calc->calculate();
+
+    $result = $calc->addDeadCard('Qh')->addDeadCard(poker_cards_to_ids('9h')[0])->calculate();
+
+    expect($result)->toBe(poker_calculate_equity($hands, $board, 10000, ['Qh', '9h'], ['cache' => false]));
+    expect($result[0]['wins'] + $result[1]['wins'] + $result[0]['ties'])->toBe(42);
+});
+
+test('tracks the board and dead cards', function () {
+    $calc = new EquityCalculator(['Ah Kh', '7c 7d'], poker_cards_to_mask('2h 8h Tc'), ['9c']);
+    $calc->addBoardCard('3s');
+
+    expect($calc->board())->toBe(['2h', '8h', 'Tc', '3s']);
+    expect($calc->deadCards())->toBe(['9c']);
+});
+
+test('keeps the options of the scenario', function () {
+    $calc = new EquityCalculator(['Ah Kh Qd Jd', '7c 7d 8s 9s'], ['2h', '8h', 'Tc'], null, ['game' => 'omaha', 'hilo' => true]);
+
+    expect($calc->calculate())->toBe(poker_calculate_equity(['Ah Kh Qd Jd', '7c 7d 8s 9s'], ['2h', '8h', 'Tc'], 10000, null, ['game' => 'omaha', 'hilo' => true, 'cache' => false]));
+    expect($calc->calculate()[0])->toHaveKey('scoops');
+});
+
+test('clones keep results and follow their own cards', function () {
+    $calc = new EquityCalculator(['Ah Kh', '7c 7d'], ['2h', '8h', 'Tc', '3s']);
+    $calc->calculate();
+
+    $heart = (clone $calc)->addBoardCard('Qh');
+    $blank = (clone $calc)->addBoardCard('Qc');
+
+    expect($heart->calculate()[0]['equity'])->toBe(100.0);
+    expect($blank->calculate()[1]['equity'])->toBe(100.0);
+    expect($calc->board())->toHaveCount(4);
+});
+
+test('rejects cards already in play', function () {
+    $calc = new EquityCalculator(['Ah Kh', '7c 7d'], ['2h', '8h', 'Tc']);
+
+    expect(fn() => $calc->addBoardCard('Ah'))->toThrow(Exception::class, 'Duplicate card found on board');
+    expect(fn() => $calc->addDeadCard('8h'))->toThrow(Exception::class, 'Dead card already in use by player or on board');
+    expect(fn() => $calc->addBoardCard('Xx'))->toThrow(Exception::class, 'Invalid board card format');
+});
+
+test('rejects a sixth board card', function () {
+    $calc = new EquityCalculator(['Ah Kh', '7c 7d'], ['2h', '8h', 'Tc', '3s', 'Qd']);
+
+    expect(fn() => $calc->addBoardCard('4c'))->toThrow(Exception::class, 'Board cannot have more than 5 cards');
+});
+
+test('checks the scenario when constructed', function () {
+    expect(fn() => new EquityCalculator(['Ah Kh']))
+        ->toThrow(Exception::class, 'At least 2 players needed for equity calculation');
+    expect(fn() => new EquityCalculator(['Ah Kh', 'Ah Kd']))
+        ->toThrow(Exception::class, 'Duplicate hole card found');
+    expect(fn() => new EquityCalculator(['Ah Kh', '7c 7d'], null, null, ['mode' => 'fast']))
+        ->toThrow(Exception::class, 'Invalid equity mode (need auto, exact or monte_carlo)');
+});
+
+test('accepts hand ranges', function () {
+    $calc = new EquityCalculator(['Ah Kh', 'QQ+'], ['2h', '8h', 'Tc'], null, ['seed' => 7]);
+    $result = $calc->addBoardCard('3s')->calculate(2000);
+
+    expect($result)->toBe(poker_calculate_equity(['Ah Kh', 'QQ+'], ['2h', '8h', 'Tc', '3s'], 2000, null, ['seed' => 7, 'cache' => false]));
+});
@@ -56,12 +56,69 @@ test('correctly identifies the best 5-card hand from 7 cards', function ($handSt
 ]);
 
 
+test('correctly identifies the best 5-card hand from 6 cards', function ($handString, $expectedName, $expectedRank) {
+    $result = poker_evaluate_hand($handString);
+
+    expect($result)->toBeArray()
+                   ->toHaveKeys(['value', 'rank', 'name', 'cards'])
+                   ->and($result['rank'])->toBe($expectedRank)
+                   ->and($result['name'])->toBe($expectedName)
+                   ->and($result['cards'])->toBe(6);
+})->with([
+    'Royal Flush in 6 cards' => ['Ah Kh Qh Jh Th 9s', 'Straight Flush', 1],
+    'Four of a Kind in 6 cards' => ['8c 8s 8h 8d Kh 2c', 'Four of a Kind', 2],
+    'Full House from two trips' => ['Qc Qh Qs 3c 3h 3d', 'Full House', 3],
+    'Flush with a sixth suited card' => ['2d 7d 9d Jd Ad 5d', 'Flush', 4],
+    'Straight with extra card' => ['9c Th Jc Qd Kh 2c', 'Straight', 5],
+    'Three of a Kind in 6 cards' => ['5s 5h 5d Jc 2d 7h', 'Three of a Kind', 6],
+    'Three pairs' => ['8s 8h Tc Td 3c 3d', 'Two Pair', 7],
+    'One Pair in 6 cards' => ['As Ah 7c 4d 2s 9d', 'One Pair', 8],
+    'High Card in 6 cards' => ['Kh Td 7c 4s 2d 3h', 'High Card', 9],
+]);
+
+
+test('6- and 7-card values match the best 5-card subset', function ($cards) {
+    $best = null;
+    $count = count($cards);
+
+    for ($skip1 = 0; $skip1 < $count; $skip1++) {
+        for ($skip2 = $count === 7 ? $skip1 + 1 : $count; $skip2 <= $count; $skip2++) {
+            $subset = [];
+            foreach ($cards as $i => $card) {
+                if ($i !== $skip1 && $i !== $skip2) {
+                    $subset[] = $card;
+                }
+            }
+
+            if (count($subset) !== 5) {
+                continue;
+            }
+
+            $value = poker_evaluate_hand(implode(' ', $subset))['value'];
+            $best = $best === null ? $value : min($best, $value);
+        }
+    }
+
+    expect(poker_evaluate_hand(implode(' ', $cards))['value'])->toBe($best);
+})->with([
+    'Six cards, two pair kicker' => [['Ks', 'Kd', '9h', '9c', '4s', 'Qd']],
+    'Six cards, wheel' => [['Ac', '2d', '3h', '4s', '5c', 'Kd']],
+    'Seven cards, trips on paired board' => [['7s', '7d', '7h', 'Ac', 'Ad', 'Kc', '2s']],
+    'Seven cards, six to a flush' => [['2h', '5h', '8h', 'Th', 'Qh', 'Ah', 'Ad']],
+    'Seven cards, steel wheel with gutshot' => [['As', '2s', '3s', '4s', '5s', '6d', '9c']],
+]);
+
+
 test('throws exception for invalid input', function ($handString, $exceptionMessage) {
     expect(fn() => poker_evaluate_hand($handString))->toThrow(Exception::class, $exceptionMessage);
 })->with([
     'Invalid card' => ['Ah Kh Qh Jh Xx', 'Invalid card format in hand'],
-    'Too few cards' => ['Ah Kh Qh Jh', 'Invalid number of cards (need exactly 5 or 7)'],
-    'Six cards (neither 5 nor 7)' => ['Ah Kh Qh Jh Th 9s', 'Invalid number of cards (need exactly 5 or 7)'],
+    'Too few cards' => ['Ah Kh Qh Jh', 'Invalid number of cards (need exactly 5, 6 or 7)'],
+    'Empty hand' => ['', 'Invalid number of cards (need exactly 5, 6 or 7)'],
+    'Repeated card' => ['Ah Ah Kd Qc Js', 'Duplicate card found in hand'],
+    'Repeated card in six' => ['7c As As As As As', 'Duplicate card found in hand'],
+    'Repeated card in seven' => ['As As As As As 6c Kd', 'Duplicate card found in hand'],
+    'Repeated card ids' => [[51, 51, 51, 51, 51, 51, 51], 'Duplicate card found in hand'],
 ]);
 
 
@@ -0,0 +1,76 @@
+<?php
+
+test('has the poker_evaluate_hands function', function () {
+    expect(function_exists('poker_evaluate_hands'))->toBeTrue();
+});
+
+test('evaluates a batch of hands in input order', function () {
+    $hands = ['Ah Kh Qh Jh Th', 'As Ah 7c 4d 2s 9h Tc', '8c 8s 8h 8d Kh 2c', 'Kh Td 7c 4s 2d'];
+    $result = poker_evaluate_hands($hands);
+
+    expect($result)->toHaveKeys(['values', 'ranks']);
+    expect($result['values'])->toHaveCount(4);
+
+    foreach ($hands as $i => $hand) {
+        $single = poker_evaluate_hand($hand);
+
+        expect($result['values'][$i])->toBe($single['value']);
+        expect($result['ranks'][$i])->toBe($single['rank']);
+    }
+});
+
+test('accepts hands as lists of card ids', function () {
+    // As Ks 7c 6d 6h
+    $result = poker_evaluate_hands([[51, 50, 5, 17, 30]]);
+
+    expect($result['values'][0])->toBe(poker_evaluate_hand('As Ks 7c 6d 6h')['value']);
+    expect($result['ranks'][0])->toBe(8);
+});
+
+test('matches poker_evaluate_hand for mixed batches of every size', function () {
+    // Long enough for full vector batches plus a scalar tail
+    $deck = [];
+    foreach (['c', 'd', 'h', 's'] as $suit) {
+        foreach (str_split('23456789TJQKA') as $rank) {
+            $deck[] = $rank . $suit;
+        }
+    }
+
+    mt_srand(12);
+    $hands = [];
+    for ($i = 0; $i < 1003; $i++) {
+        $cards = $deck;
+        shuffle($cards);
+        $hands[] = implode(' ', array_slice($cards, 0, 5 + $i % 3));
+    }
+
+    $result = poker_evaluate_hands($hands);
+
+    foreach ($hands as $i => $hand) {
+        expect($result['values'][$i])->toBe(poker_evaluate_hand($hand)['value']);
+    }
+});
+
+test('returns empty lists for no hands', function () {
+    expect(poker_evaluate_hands([]))->toBe(['values' => [], 'ranks' => []]);
+});
+
+test('evaluates 100k hands in one call', function () {
+    $result = poker_evaluate_hands(array_fill(0, 100000, '9c 8c 7c 6c 5c 2d 2h'));
+
+    expect($result['values'])->toHaveCount(100000);
+    expect(array_unique($result['ranks']))->toBe([1]);
+});
+
+test('throws on an invalid hand', function () {
+    expect(fn() => poker_evaluate_hands(['Ah Kh Qh Jh Th', 'Ah Kh Xx Jh Th']))
+        ->toThrow(Exception::class, 'Invalid card format in hand');
+    expect(fn() => poker_evaluate_hands(['Ah Kh Qh Jh']))
+        ->toThrow(Exception::class, 'Invalid number of cards (need exactly 5, 6 or 7)');
+    expect(fn() => poker_evaluate_hands([[51, 50, 5, 17, 52]]))
+        ->toThrow(Exception::class, 'Invalid card format in hand');
+    expect(fn() => poker_evaluate_hands(['Ah Kh Qh Jh Th', 'As As As As As 6c Kd']))
+        ->toThrow(Exception::class, 'Duplicate card found in hand');
+    expect(fn() => poker_evaluate_hands([[51, 51, 51, 51, 51, 51]]))
+        ->toThrow(Exception::class, 'Duplicate card found in hand');
+});
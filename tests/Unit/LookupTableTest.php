@@ -0,0 +1,66 @@
+<?php
+
+test('has the poker_generate_lookup_table function', function () {
+    expect(function_exists('poker_generate_lookup_table'))->toBeTrue();
+});
+
+test('throws when the lookup table cannot be written', function () {
+    $path = sys_get_temp_dir() . '/phpoker-missing-' . uniqid() . '/table.bin';
+
+    expect(fn() => poker_generate_lookup_table($path))
+        ->toThrow(Exception::class, 'Unable to write the lookup table file');
+});
+
+test('the configured evaluator backend gives the same values', function () {
+    // Values are identical whichever backend phpoker.evaluator selects
+    expect(poker_evaluate_hand('Ah Kh Qh Jh Th 2c 3d')['value'])->toBe(1);
+    expect(poker_evaluate_hand('8c 8s 8h 8d Kh 2c')['value'])->toBe(poker_evaluate_hand('8c 8s 8h 8d Kh')['value']);
+    expect(poker_evaluate_hand('Kh Td 7c 4s 2d 3h 5c')['value'])->toBe(poker_evaluate_hand('Kh Td 7c 4s 5c')['value']);
+});
+
+test('a generated table gives the same values and equities as the default backend', function () {
+    $path = tempnam(sys_get_temp_dir(), 'phpoker-tpt-');
+
+    expect(poker_generate_lookup_table($path))->toBeTrue();
+
+    // Random 5, 6 and 7 card hands from a fixed seed
+    mt_srand(2);
+    $deck = [];
+    foreach (['c', 'd', 'h', 's'] as $suit) {
+        foreach (str_split('23456789TJQKA') as $rank) {
+            $deck[] = $rank . $suit;
+        }
+    }
+
+    $hands = [];
+    for ($i = 0; $i < 3000; $i++) {
+        shuffle($deck);
+        $hands[] = implode(' ', array_slice($deck, 0, 5 + $i % 3));
+    }
+
+    $code = '
+        $hands = ' . var_export($hands, true) . ';
+        ob_start();
+        phpinfo(INFO_MODULES);
+        $info = ob_get_clean();
+        echo json_encode([
+            "mapped" => str_contains($info, "Two Plus Two (mapped)"),
+            "values" => array_map(fn($hand) => poker_evaluate_hand($hand)["value"], $hands),
+            "flop" => poker_calculate_equity(["Ah Kh", "7c 7d", "Qs Js"], ["2h", "8h", "Tc"], 0, null, ["mode" => "exact", "cache" => false]),
+            "turn" => poker_calculate_equity(["Ah Kh", "7c 7d"], ["2h", "8h", "Tc", "3s"], 0, ["9h"], ["mode" => "exact", "cache" => false]),
+            "sampled" => poker_calculate_equity(["Ah Kd", "Qc Qs", "7h 6h"], [], 20000, null, ["seed" => 4, "cache" => false]),
+        ]);
+    ';
+
+    $twoplustwo = phpoker_run(['phpoker.evaluator' => 'twoplustwo', 'phpoker.lookup_table' => $path], $code);
+    $cactus = phpoker_run(['phpoker.evaluator' => 'cactus'], $code);
+    unlink($path);
+
+    expect($twoplustwo['mapped'])->toBeTrue();
+    expect($cactus['mapped'])->toBeFalse();
+    expect($twoplustwo['values'])->toBe($cactus['values']);
+    expect($twoplustwo['values'])->toBe(array_map(fn($hand) => poker_evaluate_hand($hand)['value'], $hands));
+    expect($twoplustwo['flop'])->toBe($cactus['flop']);
+    expect($twoplustwo['turn'])->toBe($cactus['turn']);
+    expect($twoplustwo['sampled'])->toBe($cactus['sampled']);
+});
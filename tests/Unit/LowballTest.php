@@ -0,0 +1,91 @@
+<?php
+
+test('has the poker_evaluate_low function', function () {
+    expect(function_exists('poker_evaluate_low'))->toBeTrue();
+});
+
+test('evaluates ace-to-five eight-or-better lows', function () {
+    expect(poker_evaluate_low('Ah 2c 3d 4s 5h'))->toBe(['value' => 1, 'name' => '5-4-3-2-A']);
+    expect(poker_evaluate_low('8h 7c 6d 5s 4h'))->toBe(['value' => 56, 'name' => '8-7-6-5-4']);
+
+    // Pairs are skipped, straights and flushes ignored
+    $result = poker_evaluate_low(['Ah', 'Ad', '2h', '6h', '7h', '8h', 'Kc']);
+
+    expect($result['name'])->toBe('8-7-6-2-A');
+    expect($result['value'])->toBeLessThan(poker_evaluate_low('8h 7c 6d 3s Ah')['value']);
+});
+
+test('reports hands without an eight-or-better low', function () {
+    expect(poker_evaluate_low('Ah 2c 3d 9s Kh'))->toBe(['value' => 0, 'name' => 'No Low']);
+    expect(poker_evaluate_low('Ah Ac 2d 2s 3h 3c 4d')['value'])->toBe(0);
+});
+
+test('evaluates deuce-to-seven lowball', function () {
+    $best = poker_evaluate_low('7c 5d 4h 3s 2c', 'deuce_seven');
+
+    expect($best)->toBe(['value' => 1, 'name' => 'High Card']);
+
+    // Aces are high and A-5-4-3-2 is no straight
+    $wheel = poker_evaluate_low('Ac 5d 4h 3s 2c', 'deuce_seven');
+
+    expect($wheel['name'])->toBe('High Card');
+    expect($wheel['value'])->toBeGreaterThan(poker_evaluate_low('Kc Qd Jh Ts 8c', 'deuce_seven')['value']);
+    expect($wheel['value'])->toBeLessThan(poker_evaluate_low('Ac 6d 4h 3s 2c', 'deuce_seven')['value']);
+
+    // Straights and flushes count against the hand
+    expect(poker_evaluate_low('6c 5d 4h 3s 2c', 'deuce_seven')['name'])->toBe('Straight');
+    expect(poker_evaluate_low('8c 6c 4c 3c 2c', 'deuce_seven')['value'])->toBeGreaterThan(poker_evaluate_low('Kc Kd 4h 3s 2c', 'deuce_seven')['value']);
+});
+
+test('rejects invalid lowball hands', function ($hand, $type, $message) {
+    expect(fn() => poker_evaluate_low($hand, $type))->toThrow(Exception::class, $message);
+})->with([
+    'seven cards of 2-7' => ['7c 5d 4h 3s 2c Kd Qd', 'deuce_seven', 'Invalid number of cards (need exactly 5)'],
+    'four cards' => ['Ah 2c 3d 4s', 'ace_five', 'Invalid number of cards (need exactly 5, 6 or 7)'],
+    'unknown type' => ['Ah 2c 3d 4s 5h', 'razz', 'Invalid lowball type (need ace_five or deuce_seven)'],
+    'repeated card' => ['Ah Ah 2c 3d 4s', 'ace_five', 'Duplicate card found in hand'],
+    'repeated card of 2-7' => ['7c 7c 4h 3s 2c', 'deuce_seven', 'Duplicate card found in hand'],
+]);
+
+test('reports the Omaha low with exactly two hole cards', function () {
+    expect(poker_evaluate_omaha('Ac 2d Kh Kd', '3c 4h 8s Qd Jc')['low'])->toBe(poker_evaluate_low('Ac 2d 3c 4h 8s')['value']);
+
+    // Only one low hole card
+    expect(poker_evaluate_omaha('Ac Kd Kh Qd', '2c 3h 4s 5d Jc')['low'])->toBe(0);
+});
+
+test('splits Omaha Hi-Lo pots between high and low', function () {
+    $options = ['game' => 'omaha', 'hilo' => true, 'mode' => 'exact'];
+    $result = poker_calculate_equity(['Ac 2d Kh Kd', '3c 4c 5h 6h', 'Qs Js 7d 8d'], ['7s', '8h', 'Tc'], 1000, null, $options);
+    $total = array_sum(array_column($result, 'equity'));
+
+    expect($total)->toBeGreaterThan(99.99)->toBeLessThan(100.01);
+    expect(array_column($result, 'scoops'))->toBe([63, 76, 107]);
+    expect(array_column($result, 'wins'))->toBe([94, 237, 335]);
+    expect($result[2]['low_only'])->toBe(0);
+});
+
+test('counts a half won alone with a tied half as a partial scoop', function () {
+    // Kings take the high alone, both players share 8-7-3-2-A
+    $result = poker_calculate_equity(['Kd Ah', 'As Qh'], ['2c', '3d', '7h', '8c', 'Ks'], 1000, null, ['hilo' => true]);
+    $counts = fn(array $player) => [$player['scoops'], $player['high_only'], $player['low_only'], $player['partial_scoops']];
+
+    expect($result[0]['equity'])->toBe(75.0);
+    expect($result[1]['equity'])->toBe(25.0);
+    expect($counts($result[0]))->toBe([0, 0, 0, 1]);
+    expect($counts($result[1]))->toBe([0, 0, 1, 0]);
+});
+
+test('scoops the whole pot when no low qualifies', function () {
+    $options = ['hilo' => true];
+    $result = poker_calculate_equity(['Ah Ad', 'Kh Kd'], ['As', 'Kc', 'Qd', 'Jh', '9s'], 1000, null, $options);
+
+    expect($result[0]['equity'])->toBe(100.0);
+    expect($result[0]['scoops'])->toBe(1);
+    expect($result[1]['equity'])->toBe(0.0);
+});
+
+test('rejects hi-lo in short deck', function () {
+    expect(fn() => poker_calculate_equity(['Ah Kh', '9c 9d'], [], 1000, null, ['game' => 'shortdeck', 'hilo' => true]))
+        ->toThrow(Exception::class, 'Hi-lo is not played with a short deck');
+});
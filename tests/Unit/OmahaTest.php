@@ -0,0 +1,69 @@
+<?php
+
+test('has the poker_evaluate_omaha function', function () {
+    expect(function_exists('poker_evaluate_omaha'))->toBeTrue();
+});
+
+test('uses exactly two hole cards and three board cards', function () {
+    // Four hearts on board and one in hand is no flush in Omaha
+    $result = poker_evaluate_omaha('Ah Kd Kc 3s', '2h 5h 8h 9h Jc');
+
+    expect($result['value'])->toBe(poker_evaluate_hand('Kd Kc Jc 9h 8h')['value']);
+    expect($result['name'])->toBe('One Pair');
+
+    // A four-card straight on board needs two hole cards, not one
+    $result = poker_evaluate_omaha('As Ad 2c 3c', 'Kh Qh Jh Th 4d');
+
+    expect($result['value'])->toBe(poker_evaluate_hand('As Ad Kh Qh Jh')['value']);
+});
+
+test('evaluates five-card Omaha hands and short boards', function () {
+    $result = poker_evaluate_omaha(['Qs', 'Js', '2c', '3d', '4h'], 'Ks As Ts');
+
+    expect($result['name'])->toBe('Straight Flush');
+    expect(poker_evaluate_omaha('Qs Js 2c 3d', 'Ks As Ts 5h')['value'])->toBe($result['value']);
+});
+
+test('rejects invalid Omaha hands', function ($hole, $board, $message) {
+    expect(fn() => poker_evaluate_omaha($hole, $board))->toThrow(Exception::class, $message);
+})->with([
+    'three hole cards' => ['Ah Kd Qc', '2h 5h 8h', 'Invalid number of hole cards (need exactly 4 or 5)'],
+    'two board cards' => ['Ah Kd Qc Js', '2h 5h', 'Invalid number of board cards (need exactly 3, 4 or 5)'],
+    'shared card' => ['Ah Kd Qc Js', 'Ah 5h 8h', 'Duplicate card found in hand'],
+    'bad card' => ['Ah Kd Qc Xx', '2h 5h 8h', 'Invalid card format in hand'],
+]);
+
+test('calculates Omaha equity on a complete board', function () {
+    $result = poker_calculate_equity(['Ah Kd Kc 3s', '7c 6d 2s 2d'], ['2h', '5h', '8h', '9h', 'Jc'], 1000, null, ['game' => 'omaha']);
+
+    expect($result[0]['equity'])->toBe(0.0);
+    expect($result[1]['equity'])->toBe(100.0);
+});
+
+test('enumerates Omaha flops exactly', function () {
+    // 666 turn and river cards, none of them tied
+    $result = poker_calculate_equity(['Ah Ad Kh Kd', 'Qs Js Ts 9s', '7c 8c 9d 6h'], ['Ac', '5s', '7h'], 1000, null, ['game' => 'omaha', 'mode' => 'exact']);
+
+    expect(array_column($result, 'wins'))->toBe([362, 59, 245]);
+    expect(array_column($result, 'ties'))->toBe([0, 0, 0]);
+});
+
+test('simulates five-card Omaha', function () {
+    $options = ['game' => 'omaha5', 'seed' => 5];
+    $result = poker_calculate_equity(['Ah Ad Kh Kd 2c', 'Qs Js Ts 9s 3c', '7c 8c 9d 6h 4d'], [], 20000, null, $options);
+    $total = array_sum(array_map(fn($player) => $player['equity'], $result));
+
+    expect($total)->toBeGreaterThan(99.99);
+    expect($total)->toBeLessThan(100.01);
+    expect(poker_calculate_equity(['Ah Ad Kh Kd 2c', 'Qs Js Ts 9s 3c', '7c 8c 9d 6h 4d'], [], 20000, null, $options))->toBe($result);
+});
+
+test('checks Omaha hole cards', function ($hole, $game, $message) {
+    expect(fn() => poker_calculate_equity($hole, [], 1000, null, ['game' => $game]))->toThrow(Exception::class, $message);
+})->with([
+    'hold\'em hands in Omaha' => [['Ah Ad', 'Kh Kd'], 'omaha', 'Each player must have exactly 4 hole cards'],
+    'four cards in five-card Omaha' => [['Ah Ad Kh Kd', 'Qs Js Ts 9s'], 'omaha5', 'Each player must have exactly 5 hole cards'],
+    'shared card' => [['Ah Ad Kh Kd', 'Ah Js Ts 9s'], 'omaha', 'Duplicate hole card found'],
+    'hand range' => [['Ah Ad Kh Kd', new PHPoker\Range('QQ+')], 'omaha', "Hand ranges are only supported in hold'em"],
+    'unknown game' => [['Ah Ad Kh Kd', 'Qs Js Ts 9s'], 'stud', 'Invalid game (need holdem, omaha, omaha5 or shortdeck)'],
+]);
@@ -0,0 +1,42 @@
+<?php
+
+test('has the preflop chart functions', function () {
+    expect(function_exists('poker_preflop_equity'))->toBeTrue();
+    expect(function_exists('poker_generate_preflop_chart'))->toBeTrue();
+});
+
+test('looks up the equity of a starting hand class', function () {
+    expect(poker_preflop_equity('AA'))->toBe(85.2);
+    expect(poker_preflop_equity('AA', 9))->toBeGreaterThan(30.0)->toBeLessThan(32.0);
+    expect(poker_preflop_equity('72o'))->toBeLessThan(poker_preflop_equity('72s'));
+});
+
+test('equity falls as opponents are added', function () {
+    $previous = 100.0;
+
+    foreach (range(1, 9) as $opponents) {
+        $equity = poker_preflop_equity('KQs', $opponents);
+
+        expect($equity)->toBeLessThan($previous);
+        $previous = $equity;
+    }
+});
+
+test('accepts two cards and classes without suitedness', function () {
+    expect(poker_preflop_equity('AhKh', 3))->toBe(poker_preflop_equity('AKs', 3));
+    expect(poker_preflop_equity('Ah Kd', 3))->toBe(poker_preflop_equity('AKo', 3));
+
+    $mixed = poker_preflop_equity('AK', 2);
+
+    expect($mixed)->toBeGreaterThan(poker_preflop_equity('AKo', 2));
+    expect($mixed)->toBeLessThan(poker_preflop_equity('AKs', 2));
+});
+
+test('rejects invalid hands and opponent counts', function () {
+    expect(fn() => poker_preflop_equity('AKx'))
+        ->toThrow(Exception::class, 'Invalid starting hand (need a class like AKs or two cards)');
+    expect(fn() => poker_preflop_equity('AAs'))
+        ->toThrow(Exception::class, 'Invalid starting hand (need a class like AKs or two cards)');
+    expect(fn() => poker_preflop_equity('AK', 10))
+        ->toThrow(Exception::class, 'Number of opponents must be between 1 and 9');
+});
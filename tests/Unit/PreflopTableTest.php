@@ -0,0 +1,45 @@
+<?php
+
+test('has the poker_generate_preflop_table function', function () {
+    expect(function_exists('poker_generate_preflop_table'))->toBeTrue();
+});
+
+test('throws when the preflop table cannot be written', function () {
+    $path = sys_get_temp_dir() . '/phpoker-missing-' . uniqid() . '/preflop.bin';
+
+    expect(fn() => poker_generate_preflop_table($path))
+        ->toThrow(Exception::class, 'Unable to write the preflop table file');
+});
+
+test('heads-up preflop calls are answered from the table', function () {
+    $code = '
+        ob_start();
+        phpinfo(INFO_MODULES);
+        $info = ob_get_clean();
+        $equity = fn(array $hands) => array_map(
+            fn($player) => [$player["wins"], $player["ties"]],
+            poker_calculate_equity($hands, [], 10000, null, ["seed" => 1, "cache" => false])
+        );
+        echo json_encode([
+            "mapped" => str_contains($info, "Preflop table => mapped"),
+            "aces" => $equity(["Ah Ad", "Kh Kd"]),
+            "kings" => $equity(["Ks Kc", "As Ac"]),
+            "suited" => $equity(["Ah Kh", "Qd Qc"]),
+            "queens" => $equity(["Qs Qc", "Ad Kd"]),
+        ]);
+    ';
+
+    $table = phpoker_run(['phpoker.preflop_table' => dirname(__DIR__, 2) . '/data/preflop.bin'], $code);
+
+    // Exact counts out of 1,712,304 boards, where auto mode would otherwise sample 10,000
+    expect($table['mapped'])->toBeTrue();
+    expect($table['aces'])->toBe([[1410336, 9308], [292660, 9308]]);
+    expect($table['kings'])->toBe([[292660, 9308], [1410336, 9308]]);
+    expect($table['suited'])->toBe([[787966, 6732], [917606, 6732]]);
+    expect($table['queens'])->toBe([[917606, 6732], [787966, 6732]]);
+
+    $sampled = phpoker_run(['phpoker.preflop_table' => ''], $code);
+
+    expect($sampled['mapped'])->toBeFalse();
+    expect($sampled['aces'][0][0] + $sampled['aces'][1][0] + $sampled['aces'][0][1])->toBe(10000);
+});
@@ -0,0 +1,80 @@
+<?php
+
+use PHPoker\Range;
+
+// Make sure the extension is loaded
+beforeAll(function () {
+    if (!extension_loaded('phpoker')) {
+        throw new Exception("The phpoker extension is not loaded. Please check your installation.\n");
+    }
+});
+
+test('range class exists', function () {
+    expect(class_exists(Range::class))->toBeTrue();
+});
+
+test('range notation is parsed into combos', function () {
+    expect(count(new Range('QQ+')))->toBe(18);
+    expect(count(new Range('AKs')))->toBe(4);
+    expect(count(new Range('AKo')))->toBe(12);
+    expect(count(new Range('T9s-76s')))->toBe(16);
+    expect(count(new Range('A5s-A2s')))->toBe(16);
+    expect(count(new Range('AhKh')))->toBe(1);
+    expect(count(new Range()))->toBe(0);
+});
+
+test('invalid range notation throws', function () {
+    expect(fn() => new Range('QQ-'))->toThrow(Exception::class, 'Invalid hand range');
+    expect(fn() => new Range('AsKs+'))->toThrow(Exception::class, 'Invalid hand range');
+    expect(fn() => new Range('QQ+, AhKh+'))->toThrow(Exception::class, 'Invalid hand range');
+});
+
+test('set operations', function () {
+    $big = new Range('TT+, AK');
+    $small = new Range('QQ+, AKs, 99');
+
+    expect(count($big->union($small)))->toBe(52);
+    expect(count($big->intersect($small)))->toBe(22);
+    expect(count($big->subtract($small)))->toBe(24);
+});
+
+test('removing cards drops blocked combos', function () {
+    $range = new Range('AA, KK');
+
+    expect(count($range->removeCards('As Kd')))->toBe(6);
+    // Bit of the ace of spades: suit index 3 * 13 + rank 12
+    expect(count($range->removeCards(1 << 51)))->toBe(9);
+    expect(count($range))->toBe(12);
+});
+
+test('weights', function () {
+    $range = (new Range('AA, KK'))->withWeight(0.5, 'KK');
+
+    expect($range->weight('AsAh'))->toBe(1.0);
+    expect($range->weight('KsKh'))->toBe(0.5);
+    expect($range->weight('QsQh'))->toBe(0.0);
+    expect($range->weightedCount())->toBe(9.0);
+    expect((new Range('AKs:0.25'))->weightedCount())->toBe(1.0);
+    expect(count($range->withWeight(0.0, 'KK')))->toBe(6);
+});
+
+test('contains and iteration', function () {
+    $range = new Range('AA');
+
+    expect($range->contains('Ah Ad'))->toBeTrue();
+    expect($range->contains('KhKd'))->toBeFalse();
+
+    $combos = [];
+    foreach ($range as $combo => $weight) {
+        $combos[$combo] = $weight;
+    }
+
+    expect($combos)->toHaveCount(6)->toHaveKey('AsAc');
+    expect($combos)->toBe($range->toArray());
+});
+
+test('ranges can be used as hole cards', function () {
+    $result = poker_calculate_equity(['Ah Ad', new Range('KK')], [], 1000000);
+
+    expect($result[0]['equity'])->toBeGreaterThan(82.4)->toBeLessThan(82.8);
+});
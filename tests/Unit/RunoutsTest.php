@@ -0,0 +1,71 @@
+<?php
+
+test('has the poker_calculate_runouts function', function () {
+    expect(function_exists('poker_calculate_runouts'))->toBeTrue();
+});
+
+test('settles each river card on the turn', function () {
+    $result = poker_calculate_runouts(['Ah Kh', '7c 7d'], ['2h', '8h', 'Tc', '3s']);
+
+    expect($result['cards'])->toHaveCount(44);
+    expect($result['equity'])->toHaveCount(44);
+
+    $rows = array_combine($result['cards'], $result['equity']);
+
+    expect($rows['Qh'])->toBe([100.0, 0.0]);
+    expect($rows['Ac'])->toBe([100.0, 0.0]);
+    expect($rows['Qc'])->toBe([0.0, 100.0]);
+    expect($rows['7s'])->toBe([0.0, 100.0]);
+});
+
+test('returns the cards that put a player ahead as outs', function () {
+    $result = poker_calculate_runouts(['Ah Kh', '7c 7d'], ['2h', '8h', 'Tc', '3s']);
+
+    // Nine hearts, three aces and three kings; the sevens are already ahead
+    expect($result['outs'][0])->toBe(poker_cards_to_mask('3h 4h 5h 6h 7h 9h Th Jh Qh Ac Ad As Kc Kd Ks'));
+    expect($result['outs'][1])->toBe(0);
+});
+
+test('gives each turn card the exact equity over every river', function () {
+    $result = poker_calculate_runouts(['Ah Kh', '7c 7d', 'Qs Js'], ['2h', '8h', 'Tc']);
+    $rows = array_combine($result['cards'], $result['equity']);
+
+    expect($result['cards'])->toHaveCount(43);
+
+    foreach (['9s', 'Kc', '4h', '7s'] as $card) {
+        $equity = poker_calculate_equity(['Ah Kh', '7c 7d', 'Qs Js'], ['2h', '8h', 'Tc', $card], 0, null, ['mode' => 'exact', 'cache' => false]);
+
+        foreach ($equity as $player => $expected) {
+            expect($rows[$card][$player])->toEqualWithDelta($expected['equity'], 1e-9);
+        }
+    }
+});
+
+test('leaves dead cards out of the runouts', function () {
+    $result = poker_calculate_runouts(['Ah Kh', '7c 7d'], ['2h', '8h', 'Tc', '3s'], ['Qh', 'Jh']);
+
+    expect($result['cards'])->toHaveCount(42);
+    expect($result['cards'])->not->toContain('Qh');
+    expect($result['outs'][0] & poker_cards_to_mask('Qh Jh'))->toBe(0);
+});
+
+test('supports the other games', function () {
+    $omaha = poker_calculate_runouts(['Ah Kh Qd Jd', '7c 7d 8s 9s'], ['2h', '8h', 'Tc', '3s'], null, ['game' => 'omaha']);
+    $short = poker_calculate_runouts(['Ah Kh', '7c 7d'], ['6h', '8h', 'Tc'], null, ['game' => 'shortdeck']);
+
+    expect($omaha['cards'])->toHaveCount(40);
+    expect($short['cards'])->toHaveCount(29);
+    expect($short['cards'])->not->toContain('5c');
+});
+
+test('needs a flop or a turn', function () {
+    expect(fn() => poker_calculate_runouts(['Ah Kh', '7c 7d'], []))
+        ->toThrow(Exception::class, 'Runouts need a flop or a turn (3 or 4 board cards)');
+    expect(fn() => poker_calculate_runouts(['Ah Kh', '7c 7d'], ['2h', '8h', 'Tc', '3s', '4d']))
+        ->toThrow(Exception::class, 'Runouts need a flop or a turn (3 or 4 board cards)');
+});
+
+test('rejects duplicate cards', function () {
+    expect(fn() => poker_calculate_runouts(['Ah Kh', '7c 7d'], ['Ah', '8h', 'Tc']))
+        ->toThrow(Exception::class, 'Duplicate card found on board');
+});
@@ -0,0 +1,64 @@
+<?php
+
+test('has the poker_evaluate_short_deck function', function () {
+    expect(function_exists('poker_evaluate_short_deck'))->toBeTrue();
+});
+
+test('ranks flushes above full houses', function () {
+    $flush = poker_evaluate_short_deck('Ah Kh 7h 8h 9h');
+    $fullHouse = poker_evaluate_short_deck('Ah Ad As 8h 8c');
+
+    expect($flush['name'])->toBe('Flush');
+    expect($fullHouse['name'])->toBe('Full House');
+    expect($flush['value'])->toBeLessThan($fullHouse['value']);
+});
+
+test('counts A-6-7-8-9 as the lowest straight', function () {
+    $wheel = poker_evaluate_short_deck('Ah 6d 7c 8s 9h');
+
+    expect($wheel['name'])->toBe('Straight');
+    expect($wheel['value'])->toBeGreaterThan(poker_evaluate_short_deck('6h 7d 8s 9h Tc')['value']);
+    expect($wheel['value'])->toBeLessThan(poker_evaluate_short_deck('As Ad Ac Kh Qc')['value']);
+    expect(poker_evaluate_short_deck('Ah 6h 7h 8h 9h Kd Kc')['name'])->toBe('Straight Flush');
+});
+
+test('evaluates 6 and 7 card short-deck hands', function () {
+    // Five hearts beat the two pair
+    $result = poker_evaluate_short_deck(['Ah', 'Ad', 'Kh', 'Kd', '9h', '8h', '6h']);
+
+    expect($result['name'])->toBe('Flush');
+    expect($result['cards'])->toBe(7);
+    expect(poker_evaluate_short_deck('Ah Ad Kh Kd Ks 8h')['name'])->toBe('Full House');
+});
+
+test('rejects cards below six in short deck', function () {
+    expect(fn() => poker_evaluate_short_deck('Ah Kh 7h 8h 2h'))
+        ->toThrow(Exception::class, 'Short deck has no cards below six');
+    expect(fn() => poker_calculate_equity(['Ah Kh', '5c 5d'], [], 1000, null, ['game' => 'shortdeck']))
+        ->toThrow(Exception::class, 'Short deck has no cards below six');
+});
+
+test('rejects repeated cards in short deck', function () {
+    expect(fn() => poker_evaluate_short_deck('As As As As As 6c Kd'))
+        ->toThrow(Exception::class, 'Duplicate card found in hand');
+    expect(fn() => poker_evaluate_short_deck([51, 51, 51, 51, 51, 51]))
+        ->toThrow(Exception::class, 'Duplicate card found in hand');
+});
+
+test('enumerates short-deck boards from a 36-card deck', function () {
+    // 29 cards left after the flop, so 406 turn and river pairs
+    $result = poker_calculate_equity(['Ah Kh', '9c 9d'], ['6h', '7c', '8d'], 1000, null, ['game' => 'shortdeck', 'mode' => 'exact']);
+
+    expect($result[0]['wins'])->toBe(89);
+    expect($result[1]['wins'])->toBe(304);
+    expect($result[0]['ties'])->toBe(13);
+    expect($result[0]['equity'])->toBeGreaterThan(23.52)->toBeLessThan(23.53);
+});
+
+test('simulates short-deck equity with hand ranges', function () {
+    $options = ['game' => 'shortdeck', 'seed' => 9];
+    $result = poker_calculate_equity(['Ah Kh', 'TT+'], [], 20000, null, $options);
+
+    expect($result[0]['equity'] + $result[1]['equity'])->toBeGreaterThan(99.99)->toBeLessThan(100.01);
+    expect(poker_calculate_equity(['Ah Kh', 'TT+'], [], 20000, null, $options))->toBe($result);
+});